@@ -33,6 +33,17 @@ void setup() {
     // Standard-Hostname setzen (optional)
     wifiManager.setDefaultHostname("ESP32-Basic");
     
+    // Auf Zustandswechsel reagieren statt WiFi.status() zu pollen (optional)
+    wifiManager.onEvent([](const WiFiWebManagerEventData& event) {
+        Serial.printf("[Ereignis] %s (%d)\n", WiFiWebManager::getEventName(event.type), event.value);
+        if (event.type == WiFiWebManagerEvent::Connected) {
+            Serial.printf("WLAN: %s (RSSI: %d dBm), IP: %s\n",
+                WiFi.SSID().c_str(), event.value, WiFi.localIP().toString().c_str());
+        } else if (event.type == WiFiWebManagerEvent::APFallback) {
+            Serial.println("Modus: Access Point (Setup) - http://192.168.4.1");
+        }
+    });
+    
     // WiFiWebManager starten
     wifiManager.begin();
     
@@ -61,13 +72,6 @@ void loop() {
         Serial.println("\n--- Status ---");
         Serial.printf("Uptime: %lu Sekunden\n", millis() / 1000);
         Serial.printf("Freier Heap: %d Bytes\n", ESP.getFreeHeap());
-        
-        if (WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
-            Serial.printf("WLAN: %s (RSSI: %d dBm)\n", WiFi.SSID().c_str(), WiFi.RSSI());
-            Serial.printf("IP: %s\n", WiFi.localIP().toString().c_str());
-        } else if (WiFi.getMode() == WIFI_AP) {
-            Serial.println("Modus: Access Point (Setup)");
-        }
         Serial.println("---------------\n");
     }
     
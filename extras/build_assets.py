@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""WiFiWebManager - Asset-Pipeline
+
+Minifiziert und komprimiert die Web-Assets aus extras/web/ und erzeugt
+daraus src/WiFiWebManagerAssets.h mit PROGMEM-Byte-Arrays und ETags.
+Jedes Asset liegt gzip-komprimiert im Flash. Nur Assets, die realistisch auch
+Clients ohne gzip abrufen (die Antwort auf einen OTA-Upload per curl), bekommen
+zusaetzlich eine minifizierte Rohfassung - alle anderen kosten so nur den
+gzip-Platz.
+
+Nach jeder Aenderung an extras/web/ ausfuehren:
+
+    python3 extras/build_assets.py
+
+Die erzeugte Header-Datei wird mit eingecheckt, damit die Bibliothek in der
+Arduino IDE ohne zusaetzlichen Build-Schritt kompiliert.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "extras", "web")
+OUT_FILE = os.path.join(ROOT, "src", "WiFiWebManagerAssets.h")
+
+# Datei -> (Symbolname, URL oder None, Content-Type, zusaetzlich unkomprimiert ablegen)
+ASSETS = [
+    ("style.css", "STYLE_CSS", "/wwm/style.css", "text/css", False),
+    ("live.js", "LIVE_JS", "/wwm/live.js", "application/javascript", False),
+    ("update_done.html", "UPDATE_DONE_HTML", None, "text/html; charset=utf-8", True),
+]
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};:,>])\s*", r"\1", text)
+    text = text.replace(";}", "}")
+    return text.strip()
+
+
+def minify_js(text):
+    # Bewusst konservativ: nur Kommentare, Einrueckung und Leerzeilen entfernen.
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if not line or line.startswith("//"):
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    text = re.sub(r">\s+<", "><", text)
+    text = re.sub(r"\s+", " ", text)
+    return text.strip()
+
+
+MINIFIERS = {".css": minify_css, ".js": minify_js, ".html": minify_html}
+
+
+def c_array(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("        " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def main():
+    entries = []
+    report = []
+    total_src = total_min = total_gz = total_flash = 0
+
+    for filename, symbol, url, content_type, keep_raw in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), "r", encoding="utf-8") as f:
+            source = f.read()
+        ext = os.path.splitext(filename)[1]
+        minified = MINIFIERS[ext](source).encode("utf-8")
+        # mtime=0 sorgt fuer reproduzierbare Ausgabe (gleiche Eingabe -> gleicher ETag)
+        compressed = gzip.compress(minified, compresslevel=9, mtime=0)
+        etag = '"' + hashlib.sha1(compressed).hexdigest()[:16] + '"'
+        raw = minified if keep_raw else None
+        raw_etag = '"' + hashlib.sha1(minified).hexdigest()[:16] + '"' if keep_raw else None
+        flash = len(compressed) + (len(minified) if keep_raw else 0)
+
+        src_len = len(source.encode("utf-8"))
+        total_src += src_len
+        total_min += len(minified)
+        total_gz += len(compressed)
+        total_flash += flash
+        report.append("%-18s %6d -> %6d (min) -> %6d (gzip) Bytes, im Flash %6d" %
+                      (filename, src_len, len(minified), len(compressed), flash))
+        entries.append((filename, symbol, url, content_type, compressed, etag,
+                        raw, raw_etag, src_len, len(minified)))
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Automatisch erzeugt von extras/build_assets.py - NICHT von Hand bearbeiten!")
+    out.append("// Quellen: extras/web/")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("namespace WiFiWebManagerAssets {")
+    out.append("    struct Asset {")
+    out.append("        const char* path;         // URL oder nullptr (nur intern verwendet)")
+    out.append("        const char* contentType;")
+    out.append("        const uint8_t* data;      // gzip-komprimiert, liegt im Flash")
+    out.append("        size_t length;")
+    out.append("        const char* etag;")
+    out.append("        const uint8_t* rawData;   // minifiziert fuer Clients ohne gzip, sonst nullptr")
+    out.append("        size_t rawLength;")
+    out.append("        const char* rawEtag;")
+    out.append("    };")
+    out.append("")
+    for (filename, symbol, url, content_type, compressed, etag, raw, raw_etag, src_len, min_len) in entries:
+        out.append("    // %s: %d Bytes Quelle, %d Bytes minifiziert, %d Bytes gzip%s" %
+                   (filename, src_len, min_len, len(compressed), "" if raw else " (nur gzip im Flash)"))
+        out.append("    static const uint8_t %s_GZ[] PROGMEM = {" % symbol)
+        out.append(c_array(compressed))
+        out.append("    };")
+        if raw:
+            out.append("    static const uint8_t %s_RAW[] PROGMEM = {" % symbol)
+            out.append(c_array(raw))
+            out.append("    };")
+        out.append("    static const Asset %s = {%s, \"%s\", %s_GZ, sizeof(%s_GZ), \"%s\"," %
+                   (symbol, '"%s"' % url if url else "nullptr", content_type, symbol,
+                    symbol, etag.replace('"', '\\"')))
+        if raw:
+            out.append("                             %s_RAW, sizeof(%s_RAW), \"%s\"};" %
+                       (symbol, symbol, raw_etag.replace('"', '\\"')))
+        else:
+            out.append("                             nullptr, 0, nullptr};")
+        out.append("")
+    out.append("    // Alle Assets mit eigener URL, werden in setupWebServer() registriert")
+    out.append("    static const Asset* const STATIC_ASSETS[] = {")
+    for e in entries:
+        if e[2]:
+            out.append("        &%s," % e[1])
+    out.append("    };")
+    out.append("}")
+    out.append("")
+
+    with open(OUT_FILE, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+    for line in report:
+        print(line)
+    print("%-18s %6d -> %6d (min) -> %6d (gzip) Bytes, im Flash %6d" %
+          ("Gesamt", total_src, total_min, total_gz, total_flash))
+    print("Geschrieben: %s" % os.path.relpath(OUT_FILE, ROOT))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
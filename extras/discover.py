@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""WiFiWebManager - Geraetesuche per mDNS/DNS-SD
+
+Findet alle Geraete im lokalen Netz mit einer einzigen Multicast-Anfrage nach dem
+Dienst _wifiwebmanager._tcp und gibt Hostname, IP, Port und die TXT-Records
+(Bibliotheksversion, Firmware-Build, API-Pfade) als JSON oder CSV aus.
+Kommt ohne Zusatzpakete aus (nur Python-Standardbibliothek).
+
+Beispiele:
+
+    python3 extras/discover.py
+    python3 extras/discover.py --timeout 5 --format csv
+    python3 extras/discover.py --status      # zusaetzlich /api/status jedes Geraets abfragen
+"""
+
+import argparse
+import csv
+import http.client
+import json
+import random
+import socket
+import struct
+import sys
+import time
+
+SERVICE = "_wifiwebmanager._tcp.local"
+MDNS_ADDR = ("224.0.0.251", 5353)
+
+TYPE_A, TYPE_PTR, TYPE_TXT, TYPE_SRV = 1, 12, 16, 33
+
+
+def encode_name(name):
+    out = b""
+    for label in name.rstrip(".").split("."):
+        raw = label.encode()
+        out += bytes([len(raw)]) + raw
+    return out + b"\x00"
+
+
+def build_query(qid):
+    # Anfrage von einem beliebigen Port ("legacy unicast", RFC 6762 6.7): Antworten kommen direkt zurueck
+    header = struct.pack("!HHHHHH", qid, 0, 1, 0, 0, 0)
+    return header + encode_name(SERVICE) + struct.pack("!HH", TYPE_PTR, 1)
+
+
+def read_name(data, pos):
+    labels = []
+    jumped = False
+    end = pos
+    for _ in range(128):
+        length = data[pos]
+        if length & 0xC0 == 0xC0:
+            if not jumped:
+                end = pos + 2
+            pos = ((length & 0x3F) << 8) | data[pos + 1]
+            jumped = True
+            continue
+        pos += 1
+        if length == 0:
+            break
+        labels.append(data[pos:pos + length].decode("utf-8", "replace"))
+        pos += length
+    if not jumped:
+        end = pos
+    return ".".join(labels), end
+
+
+def parse_records(data):
+    qdcount, ancount, nscount, arcount = struct.unpack("!HHHH", data[4:12])
+    pos = 12
+    for _ in range(qdcount):
+        _, pos = read_name(data, pos)
+        pos += 4
+    records = []
+    for _ in range(ancount + nscount + arcount):
+        name, pos = read_name(data, pos)
+        rtype, _, _, rdlength = struct.unpack("!HHIH", data[pos:pos + 10])
+        pos += 10
+        rdata = data[pos:pos + rdlength]
+        if rtype == TYPE_PTR:
+            value, _ = read_name(data, pos)
+        elif rtype == TYPE_SRV:
+            _, _, port = struct.unpack("!HHH", rdata[:6])
+            target, _ = read_name(data, pos + 6)
+            value = (target, port)
+        elif rtype == TYPE_TXT:
+            value, i = {}, 0
+            while i < len(rdata):
+                entry = rdata[i + 1:i + 1 + rdata[i]].decode("utf-8", "replace")
+                i += 1 + rdata[i]
+                if entry:
+                    key, _, val = entry.partition("=")
+                    value[key] = val
+        elif rtype == TYPE_A and rdlength == 4:
+            value = socket.inet_ntoa(rdata)
+        else:
+            value = None
+        pos += rdlength
+        records.append((name.lower(), rtype, value))
+    return records
+
+
+def discover(timeout, addr):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 255)
+    sock.settimeout(0.2)
+    qid = random.randint(1, 0xFFFF)
+    query = build_query(qid)
+
+    instances, srv, txt, addresses = set(), {}, {}, {}
+    sources = {}
+    deadline = time.time() + timeout
+    next_send = 0
+    while time.time() < deadline:
+        if time.time() >= next_send:
+            sock.sendto(query, addr)
+            next_send = time.time() + 1.0   # Wiederholung gegen Paketverlust im WLAN
+        try:
+            data, source = sock.recvfrom(9000)
+        except socket.timeout:
+            continue
+        try:
+            records = parse_records(data)
+        except (IndexError, struct.error, UnicodeDecodeError):
+            continue
+        for name, rtype, value in records:
+            if rtype == TYPE_PTR and name == SERVICE:
+                instances.add(value.lower())
+                sources[value.lower()] = source[0]
+            elif rtype == TYPE_SRV:
+                srv[name] = value
+            elif rtype == TYPE_TXT:
+                txt[name] = value
+            elif rtype == TYPE_A:
+                addresses[name] = value
+    sock.close()
+
+    devices = []
+    for instance in sorted(instances):
+        target, port = srv.get(instance, ("", 80))
+        devices.append({
+            "instance": instance[:-len(SERVICE) - 1] if instance.endswith(SERVICE) else instance,
+            "host": target,
+            "ip": addresses.get(target.lower(), sources.get(instance, "")),
+            "port": port,
+            "txt": txt.get(instance, {}),
+        })
+    return devices
+
+
+def fetch_status(device, timeout):
+    path = device["txt"].get("metrics", "/api/status")
+    try:
+        conn = http.client.HTTPConnection(device["ip"], device["port"], timeout=timeout)
+        conn.request("GET", path)
+        resp = conn.getresponse()
+        body = resp.read()
+        conn.close()
+        return json.loads(body) if resp.status == 200 else {"error": resp.status}
+    except (OSError, ValueError, http.client.HTTPException) as e:
+        return {"error": str(e)}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="WiFiWebManager-Geraete per mDNS finden")
+    parser.add_argument("--timeout", type=float, default=3, help="Wartezeit auf Antworten in Sekunden")
+    parser.add_argument("--status", action="store_true", help="zusaetzlich den API-Status jedes Geraets abrufen")
+    parser.add_argument("--format", choices=["json", "csv"], default="json")
+    parser.add_argument("--output", help="Datei statt stdout")
+    parser.add_argument("--mdns", default="%s:%d" % MDNS_ADDR, metavar="ADRESSE:PORT",
+                        help="Ziel der Anfrage (Standard: mDNS-Multicast; fuer Tests auch ein lokaler Responder)")
+    args = parser.parse_args()
+
+    host, _, port = args.mdns.rpartition(":")
+    devices = discover(args.timeout, (host, int(port)))
+    if args.status:
+        for device in devices:
+            device["status"] = fetch_status(device, args.timeout)
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    try:
+        if args.format == "json":
+            json.dump(devices, out, indent=2)
+            out.write("\n")
+        else:
+            keys = sorted({k for d in devices for k in d["txt"]})
+            writer = csv.writer(out)
+            writer.writerow(["instance", "host", "ip", "port"] + keys)
+            for d in devices:
+                writer.writerow([d["instance"], d["host"], d["ip"], d["port"]] + [d["txt"].get(k, "") for k in keys])
+    finally:
+        if out is not sys.stdout:
+            out.close()
+    print("%d Geraet(e) gefunden" % len(devices), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
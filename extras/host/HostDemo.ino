@@ -0,0 +1,62 @@
+/*
+  Host-Demo für extras/host: deckt die Seitenarten ab, die die Beispiele nicht nutzen.
+
+    make SKETCH=HostDemo.ino run
+
+  - /gross      große dynamische Seite (gzip-Stream mit Accept-Encoding: gzip)
+  - /langsam    verzögerte Seite, complete() nach 1,5 s aus loop()
+  - /static/... Dateien aus <Datenverzeichnis>/littlefs/www (Range, ETag, .gz-Varianten)
+  - Ereignisse mit Zeitstempel auf der Konsole (kill -USR1 <pid> für Disconnected/Connected)
+*/
+
+#include <WiFiWebManager.h>
+
+WiFiWebManager wifiManager;
+
+WiFiWebManager::DeferredResponse pending;
+unsigned long pendingSince = 0;
+
+void setup() {
+    Serial.begin(115200);
+    wifiManager.setDebugMode(true);
+    wifiManager.setDefaultHostname("wwm-host");
+
+    wifiManager.addPage("Groß", "/gross", [](AsyncWebServerRequest *request) -> String {
+        String html = "<h1>Messreihe</h1><table>";
+        for (int i = 0; i < 400; i++) {
+            html += "<tr><td>" + String(i) + "</td><td>" + String(20.0 + (i % 37) / 10.0, 1) + " °C</td></tr>";
+        }
+        html += "</table>";
+        return html;
+    });
+
+    wifiManager.addDeferredPage("Langsam", "/langsam", [](AsyncWebServerRequest *request, WiFiWebManager::DeferredResponse response) {
+        pending = response;
+        pendingSince = millis();
+    });
+
+    LittleFS.begin(true);
+    LittleFS.mkdir("/www");
+    File file = LittleFS.open("/www/hallo.txt", "w", true);
+    if (file) {
+        for (int i = 0; i < 100; i++) file.print("0123456789");
+        file.close();
+    }
+    wifiManager.serveStatic("/static", "/www");
+
+    wifiManager.onEvent([](const WiFiWebManagerEventData& event) {
+        Serial.printf("[%lu ms] Ereignis %s (%ld), ausgelöst bei %lu ms\n", millis(),
+                      WiFiWebManager::getEventName(event.type), (long)event.value, (unsigned long)event.timestamp);
+    });
+
+    wifiManager.begin();
+}
+
+void loop() {
+    wifiManager.loop();
+
+    if (pending.isPending() && millis() - pendingSince > 1500) {
+        pending.complete("<h1>Sensor</h1><p>Messwert: 42</p>");
+    }
+    delay(10);
+}
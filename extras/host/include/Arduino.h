@@ -0,0 +1,95 @@
+#pragma once
+
+// Host-Ersatz für den ESP32-Arduino-Core: gerade so viel, dass WiFiWebManager und die
+// Beispiele unverändert unter Linux laufen (siehe extras/host/Makefile).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+
+#include "WString.h"
+#include "IPAddress.h"
+#include "Print.h"
+#include "esp_err.h"
+
+#define PROGMEM
+#define IRAM_ATTR
+#define F(str) (str)
+#define PSTR(str) (str)
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// GPIOs gibt es auf dem Host nicht: Eingänge lesen HIGH (Taster nicht gedrückt)
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+extern "C" uint32_t esp_random();
+
+typedef enum {
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO,
+} esp_reset_reason_t;
+// Nach ESP.restart() (execv) meldet der Host ESP_RST_SW, sonst ESP_RST_POWERON
+esp_reset_reason_t esp_reset_reason();
+
+class HardwareSerial : public Stream {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+};
+extern HardwareSerial Serial;
+
+// Heap-Kennzahlen werden auf dem Host aus mallinfo2() abgeleitet, bezogen auf einen
+// ESP32-typischen Heap - gut genug für Verläufe (Lasttest), nicht für absolute Werte.
+class EspClass {
+public:
+    void restart();
+    uint32_t getHeapSize();
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    const char* getChipModel() { return "Linux host"; }
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    const char* getSdkVersion() { return "host"; }
+    uint64_t getEfuseMac();
+};
+extern EspClass ESP;
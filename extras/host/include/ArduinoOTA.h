@@ -0,0 +1,39 @@
+#pragma once
+
+// Host-Ersatz für ArduinoOTA: Callbacks werden nur gespeichert, es gibt keinen OTA-Dienst
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum {
+    OTA_AUTH_ERROR,
+    OTA_BEGIN_ERROR,
+    OTA_CONNECT_ERROR,
+    OTA_RECEIVE_ERROR,
+    OTA_END_ERROR
+} ota_error_t;
+
+class ArduinoOTAClass {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+    typedef std::function<void(ota_error_t)> THandlerFunction_Error;
+    typedef std::function<void(unsigned int, unsigned int)> THandlerFunction_Progress;
+
+    ArduinoOTAClass& setHostname(const char* name) { (void)name; return *this; }
+    ArduinoOTAClass& setPassword(const char* password) { (void)password; return *this; }
+    ArduinoOTAClass& onStart(THandlerFunction fn) { startCallback = fn; return *this; }
+    ArduinoOTAClass& onEnd(THandlerFunction fn) { endCallback = fn; return *this; }
+    ArduinoOTAClass& onError(THandlerFunction_Error fn) { errorCallback = fn; return *this; }
+    ArduinoOTAClass& onProgress(THandlerFunction_Progress fn) { progressCallback = fn; return *this; }
+    void begin() {}
+    void end() {}
+    void handle() {}
+
+private:
+    THandlerFunction startCallback;
+    THandlerFunction endCallback;
+    THandlerFunction_Error errorCallback;
+    THandlerFunction_Progress progressCallback;
+};
+
+extern ArduinoOTAClass ArduinoOTA;
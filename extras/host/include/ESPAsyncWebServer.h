@@ -0,0 +1,236 @@
+#pragma once
+
+// Host-Ersatz für ESPAsyncWebServer auf POSIX-Sockets.
+//
+// Nachgebildet ist das Verhalten, auf das sich WiFiWebManager und die Sketche verlassen:
+// - alle Handler laufen nacheinander in EINEM Server-Thread (wie der async_tcp-Task auf dem ESP32)
+// - Handler-Auswahl wie AsyncCallbackWebHandler: exakte URL, "uri/..."-Unterpfade, "präfix*", "/*.ext"
+// - Parameter: Query (post=false), urlencoded bzw. "name=..."-text/plain Body und Multipart-Felder
+//   (post=true), Multipart-Dateien an den Upload-Handler, sonstige Bodys an den Body-Handler
+// - Antworten werden erst nach Rückkehr des Handlers gesendet, immer mit "Connection: close"
+// - Callback-Antworten werden stückweise gefüllt; RESPONSE_TRY_AGAIN wird beim nächsten
+//   Poll-Tick (500 ms) erneut versucht
+// - beginChunkedResponse() liefert für HTTP/1.0 wie das Original eine Callback-Antwort mit Länge 0
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef enum {
+    HTTP_GET = 0b00000001,
+    HTTP_POST = 0b00000010,
+    HTTP_DELETE = 0b00000100,
+    HTTP_PUT = 0b00001000,
+    HTTP_PATCH = 0b00010000,
+    HTTP_HEAD = 0b00100000,
+    HTTP_OPTIONS = 0b01000000,
+    HTTP_ANY = 0b01111111,
+} WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+#define RESPONSE_TRY_AGAIN 0xFFFFFFFF
+
+class AsyncWebServer;
+class AsyncWebServerRequest;
+class AsyncWebServerResponse;
+class AsyncCallbackWebHandler;
+
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+typedef std::function<String(const String&)> AwsTemplateProcessor;
+typedef std::function<void(void)> ArDisconnectHandler;
+typedef std::function<void(AsyncWebServerRequest* request)> ArRequestHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, const String& filename, size_t index, uint8_t* data,
+                           size_t len, bool final)> ArUploadHandlerFunction;
+typedef std::function<void(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total)>
+    ArBodyHandlerFunction;
+
+class AsyncWebParameter {
+public:
+    AsyncWebParameter(const String& name, const String& value, bool form = false, bool file = false, size_t size = 0)
+        : _name(name), _value(value), _size(size), _isForm(form), _isFile(file) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+    size_t size() const { return _size; }
+    bool isPost() const { return _isForm; }
+    bool isFile() const { return _isFile; }
+
+private:
+    String _name;
+    String _value;
+    size_t _size;
+    bool _isForm;
+    bool _isFile;
+};
+
+class AsyncWebHeader {
+public:
+    AsyncWebHeader(const String& name, const String& value) : _name(name), _value(value) {}
+    const String& name() const { return _name; }
+    const String& value() const { return _value; }
+
+private:
+    String _name;
+    String _value;
+};
+
+class AsyncWebServerResponse {
+public:
+    enum class Kind { Basic, Callback, Chunked };
+
+    AsyncWebServerResponse(int code, const String& contentType, Kind kind);
+    virtual ~AsyncWebServerResponse() {}
+
+    void setCode(int code) { _code = code; }
+    void setContentLength(size_t len) { _contentLength = len; }
+    void setContentType(const String& type) { _contentType = type; }
+    void addHeader(const String& name, const String& value) { _headers.emplace_back(name, value); }
+
+private:
+    friend class AsyncWebServer;
+    friend class AsyncWebServerRequest;
+
+    int _code;
+    String _contentType;
+    Kind _kind;
+    size_t _contentLength = 0;
+    std::vector<AsyncWebHeader> _headers;
+    std::string _content;                // Basic (auch beginResponse_P)
+    AwsResponseFiller _filler;           // Callback/Chunked
+};
+
+class AsyncWebServerRequest {
+public:
+    ~AsyncWebServerRequest();
+
+    uint8_t version() const { return _version; }
+    WebRequestMethodComposite method() const { return _method; }
+    const String& url() const { return _url; }
+    String host() const { return _host; }
+    const String& contentType() const { return _contentType; }
+    size_t contentLength() const { return _contentLength; }
+    const char* methodToString() const;
+
+    size_t headers() const { return _headers.size(); }
+    bool hasHeader(const String& name) const;
+    bool hasHeader(const char* name) const { return hasHeader(String(name)); }
+    AsyncWebHeader* getHeader(const String& name) const;
+    AsyncWebHeader* getHeader(const char* name) const { return getHeader(String(name)); }
+    AsyncWebHeader* getHeader(size_t index) const;
+    String header(const char* name) const;
+
+    size_t params() const { return _params.size(); }
+    bool hasParam(const String& name, bool post = false, bool file = false) const;
+    bool hasParam(const char* name, bool post = false, bool file = false) const { return hasParam(String(name), post, file); }
+    AsyncWebParameter* getParam(const String& name, bool post = false, bool file = false) const;
+    AsyncWebParameter* getParam(const char* name, bool post = false, bool file = false) const {
+        return getParam(String(name), post, file);
+    }
+    AsyncWebParameter* getParam(size_t index) const;
+
+    size_t args() const { return _params.size(); }
+    bool hasArg(const char* name) const;
+    const String& arg(const String& name) const;
+    const String& arg(const char* name) const { return arg(String(name)); }
+
+    void send(AsyncWebServerResponse* response);
+    void send(int code, const String& contentType = String(), const String& content = String());
+    void send_P(int code, const String& contentType, const uint8_t* content, size_t len) {
+        send(beginResponse_P(code, contentType, content, len));
+    }
+    void send_P(int code, const String& contentType, const char* content) {
+        send(beginResponse_P(code, contentType, (const uint8_t*)content, strlen(content)));
+    }
+    void redirect(const String& url);
+
+    AsyncWebServerResponse* beginResponse(int code, const String& contentType = String(),
+                                          const String& content = String());
+    AsyncWebServerResponse* beginResponse(const String& contentType, size_t len, AwsResponseFiller callback,
+                                          AwsTemplateProcessor templateCallback = nullptr);
+    AsyncWebServerResponse* beginChunkedResponse(const String& contentType, AwsResponseFiller callback,
+                                                 AwsTemplateProcessor templateCallback = nullptr);
+    AsyncWebServerResponse* beginResponse_P(int code, const String& contentType, const uint8_t* content, size_t len,
+                                            AwsTemplateProcessor callback = nullptr);
+
+    void onDisconnect(ArDisconnectHandler fn) { _onDisconnect = fn; }
+
+    void* _tempObject = nullptr;
+
+private:
+    friend class AsyncWebServer;
+    friend class AsyncCallbackWebHandler;
+
+    uint8_t _version = 1;
+    WebRequestMethodComposite _method = HTTP_GET;
+    String _url;
+    String _host;
+    String _contentType;
+    size_t _contentLength = 0;
+    std::vector<std::unique_ptr<AsyncWebHeader>> _headers;
+    std::vector<std::unique_ptr<AsyncWebParameter>> _params;
+    std::unique_ptr<AsyncWebServerResponse> _response;
+    bool _sent = false;
+    ArDisconnectHandler _onDisconnect;
+};
+
+class AsyncCallbackWebHandler {
+public:
+    AsyncCallbackWebHandler& setFilter(std::function<bool(AsyncWebServerRequest*)> fn) { _filter = fn; return *this; }
+
+private:
+    friend class AsyncWebServer;
+
+    bool canHandle(AsyncWebServerRequest* request) const;
+
+    String _uri;
+    WebRequestMethodComposite _method = HTTP_ANY;
+    ArRequestHandlerFunction _onRequest;
+    ArUploadHandlerFunction _onUpload;
+    ArBodyHandlerFunction _onBody;
+    std::function<bool(AsyncWebServerRequest*)> _filter;
+};
+
+class AsyncWebServer {
+public:
+    // Der Port wird auf dem Host durch HostRuntime::httpPort() ersetzt (Standard 8080)
+    explicit AsyncWebServer(uint16_t port);
+    ~AsyncWebServer();
+
+    void begin();
+    void end();
+
+    AsyncCallbackWebHandler& on(const char* uri, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload);
+    AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest,
+                                ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody);
+    void onNotFound(ArRequestHandlerFunction fn) { _notFound = fn; }
+    void reset();
+
+private:
+    struct Connection;
+
+    void run();
+    void accept();
+    bool receive(Connection& conn);
+    bool parseHead(Connection& conn);
+    bool consumeBody(Connection& conn, const uint8_t* data, size_t len);
+    void parseMultipart(Connection& conn);
+    void handleRequest(Connection& conn);
+    bool transmit(Connection& conn);
+    void fill(Connection& conn);
+    AsyncCallbackWebHandler* findHandler(AsyncWebServerRequest* request);
+
+    uint16_t _port;
+    int _listenFd = -1;
+    int _wakeFds[2] = {-1, -1};
+    bool _running = false;
+    std::mutex _lock;
+    std::vector<std::unique_ptr<AsyncCallbackWebHandler>> _handlers;
+    ArRequestHandlerFunction _notFound;
+    std::vector<std::unique_ptr<Connection>> _connections;
+    std::unique_ptr<std::thread> _thread;
+};
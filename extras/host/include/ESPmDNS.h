@@ -0,0 +1,39 @@
+#pragma once
+
+// Host-Ersatz für ESPmDNS: merkt sich Hostname, Dienste und TXT-Records, sendet aber nichts.
+// Zum Testen von extras/discover.py dient extras/mdns_standin.py.
+
+#include <Arduino.h>
+#include <vector>
+
+class MDNSResponder {
+public:
+    struct TxtRecord {
+        String service;
+        String key;
+        String value;
+    };
+
+    bool begin(const char* hostName);
+    void end();
+    void setInstanceName(const String& name) { instanceName = name; }
+    bool addService(const char* service, const char* proto, uint16_t port);
+    bool addServiceTxt(const char* service, const char* proto, const char* key, const char* value);
+    bool addServiceTxt(const char* service, const char* proto, const String& key, const String& value) {
+        return addServiceTxt(service, proto, key.c_str(), value.c_str());
+    }
+
+    // Nur Host: aktueller Stand zum Prüfen in Tests
+    bool running() const { return active; }
+    const String& hostname() const { return hostName; }
+    const std::vector<TxtRecord>& txtRecords() const { return txt; }
+
+private:
+    bool active = false;
+    String hostName;
+    String instanceName;
+    std::vector<String> services;
+    std::vector<TxtRecord> txt;
+};
+
+extern MDNSResponder MDNS;
@@ -0,0 +1,69 @@
+#pragma once
+
+// Host-Ersatz für das Arduino-Dateisystem: Pfade werden auf ein Verzeichnis abgebildet.
+
+#include <Arduino.h>
+#include <memory>
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class File : public Stream {
+public:
+    File() {}
+    File(FILE* handle, const String& path, bool directory);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buf, size_t size) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    size_t read(uint8_t* buf, size_t size);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void close();
+    time_t getLastWrite();
+    const char* name() const;
+    const char* path() const { return filePath.c_str(); }
+    bool isDirectory() const { return directory; }
+    operator bool() const { return handle != nullptr || directory; }
+
+private:
+    std::shared_ptr<FILE> handle;
+    String filePath;
+    String fileName;
+    bool directory = false;
+};
+
+class FS {
+public:
+    explicit FS(const char* subdirectory) : subdirectory(subdirectory) {}
+
+    File open(const char* path, const char* mode = "r", bool create = false);
+    File open(const String& path, const char* mode = "r", bool create = false) { return open(path.c_str(), mode, create); }
+    bool exists(const char* path);
+    bool exists(const String& path) { return exists(path.c_str()); }
+    bool remove(const char* path);
+    bool remove(const String& path) { return remove(path.c_str()); }
+    bool mkdir(const char* path);
+    bool mkdir(const String& path) { return mkdir(path.c_str()); }
+
+protected:
+    std::string hostPath(const char* path) const;
+    std::string root() const;
+    bool mounted = false;
+
+private:
+    const char* subdirectory;
+};
+
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
@@ -0,0 +1,27 @@
+#pragma once
+
+// Einstellungen des Host-Builds (nur extras/host, nicht Teil der Bibliothek)
+#include <stdint.h>
+#include <string>
+
+namespace HostRuntime {
+    // Verzeichnis für NVS-Abbild, LittleFS-Inhalt und OTA-Uploads
+    void setDataDir(const std::string& dir);
+    const std::string& dataDir();
+
+    // AsyncWebServer(80) lauscht auf dem Host auf diesem Port (Ports < 1024 brauchen root)
+    void setHttpPort(uint16_t port);
+    uint16_t httpPort();
+
+    // ESP.restart() startet das Programm mit diesen Argumenten neu
+    void setCommandLine(int argc, char** argv);
+
+    // Zeitbasis von millis()/micros()/delay() und der simulierten Systemuhr (µs seit Start).
+    // Tests schalten auf virtuelle Zeit um: sie steht, bis advanceTime() oder delay() sie weiterstellt.
+    uint64_t monotonicUs();
+    void useVirtualTime();
+    void advanceTime(uint64_t us);
+
+    // Gangabweichung des simulierten Quarzes in ppm (+ = Systemuhr geht vor), gilt ab dem Aufruf
+    void setClockDriftPpm(double ppm);
+}
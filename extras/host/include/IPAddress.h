@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include "WString.h"
+
+// IPv4-Adresse wie im ESP32-Core: intern in Netzwerk-Byteorder, Oktett 0 zuerst
+class IPAddress {
+public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+    IPAddress(uint32_t address) { *this = address; }
+
+    IPAddress& operator=(uint32_t address);
+    operator uint32_t() const;
+    bool operator==(const IPAddress& other) const { return (uint32_t)*this == (uint32_t)other; }
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+    uint8_t operator[](int index) const { return octets[index & 3]; }
+    uint8_t& operator[](int index) { return octets[index & 3]; }
+
+    bool fromString(const char* address);
+    bool fromString(const String& address) { return fromString(address.c_str()); }
+    String toString() const;
+
+private:
+    uint8_t octets[4] = {0, 0, 0, 0};
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+// LittleFS liegt auf dem Host in <Datenverzeichnis>/littlefs (siehe HostRuntime.h)
+
+#include "FS.h"
+
+namespace fs {
+
+class LittleFSFS : public FS {
+public:
+    LittleFSFS() : FS("littlefs") {}
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs", uint8_t maxOpenFiles = 10,
+               const char* partitionLabel = "spiffs");
+    void end() { mounted = false; }
+    bool format();
+};
+
+}
+
+extern fs::LittleFSFS LittleFS;
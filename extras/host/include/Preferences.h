@@ -0,0 +1,59 @@
+#pragma once
+
+// Host-Ersatz für Preferences (ESP32-Core): dünne Schicht über dem NVS-Ersatz aus nvs.h,
+// mit denselben Typen je Schlüssel wie auf dem Gerät.
+
+#include <Arduino.h>
+#include "nvs.h"
+
+class Preferences {
+public:
+    ~Preferences() { end(); }
+
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void end();
+
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putChar(const char* key, int8_t value);
+    size_t putUChar(const char* key, uint8_t value);
+    size_t putShort(const char* key, int16_t value);
+    size_t putUShort(const char* key, uint16_t value);
+    size_t putInt(const char* key, int32_t value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putLong(const char* key, int32_t value) { return putInt(key, value); }
+    size_t putULong(const char* key, uint32_t value) { return putUInt(key, value); }
+    size_t putLong64(const char* key, int64_t value);
+    size_t putULong64(const char* key, uint64_t value);
+    size_t putFloat(const char* key, float value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putDouble(const char* key, double value) { return putBytes(key, &value, sizeof(value)); }
+    size_t putBool(const char* key, bool value) { return putUChar(key, value ? 1 : 0); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char* key, const void* value, size_t length);
+
+    int8_t getChar(const char* key, int8_t defaultValue = 0);
+    uint8_t getUChar(const char* key, uint8_t defaultValue = 0);
+    int16_t getShort(const char* key, int16_t defaultValue = 0);
+    uint16_t getUShort(const char* key, uint16_t defaultValue = 0);
+    int32_t getInt(const char* key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    int32_t getLong(const char* key, int32_t defaultValue = 0) { return getInt(key, defaultValue); }
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0) { return getUInt(key, defaultValue); }
+    int64_t getLong64(const char* key, int64_t defaultValue = 0);
+    uint64_t getULong64(const char* key, uint64_t defaultValue = 0);
+    float getFloat(const char* key, float defaultValue = NAN);
+    double getDouble(const char* key, double defaultValue = NAN);
+    bool getBool(const char* key, bool defaultValue = false) { return getUChar(key, defaultValue ? 1 : 0) == 1; }
+    String getString(const char* key, const String& defaultValue = String());
+    size_t getString(const char* key, char* value, size_t maxLen);
+    size_t getBytesLength(const char* key);
+    size_t getBytes(const char* key, void* buf, size_t maxLen);
+
+private:
+    nvs_handle_t handle = 0;
+    bool started = false;
+    bool readOnly = false;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include "WString.h"
+#include "IPAddress.h"
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str);
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned int n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(long n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(unsigned long n, int base = 10) { return print(String(n, (unsigned char)base)); }
+    size_t print(double n, int digits = 2) { return print(String(n, (unsigned int)digits)); }
+    size_t print(const IPAddress& ip) { return print(ip.toString()); }
+
+    template <typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    size_t println() { return write((const uint8_t*)"\r\n", 2); }
+};
+
+class Stream : public Print {
+public:
+    virtual int available() { return 0; }
+    virtual int read() { return -1; }
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+// Host-Ersatz für Update: das Abbild wird nach <Datenverzeichnis>/update.bin geschrieben,
+// geprüft wird nur, ob es mit dem ESP32-Image-Magic (0xE9) beginnt.
+
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#define U_FLASH 0
+#define U_SPIFFS 100
+
+#define UPDATE_ERROR_OK 0
+#define UPDATE_ERROR_WRITE 1
+#define UPDATE_ERROR_ERASE 2
+#define UPDATE_ERROR_READ 3
+#define UPDATE_ERROR_SPACE 4
+#define UPDATE_ERROR_SIZE 5
+#define UPDATE_ERROR_STREAM 6
+#define UPDATE_ERROR_MD5 7
+#define UPDATE_ERROR_MAGIC_BYTE 8
+#define UPDATE_ERROR_ACTIVATE 9
+#define UPDATE_ERROR_NO_PARTITION 10
+#define UPDATE_ERROR_BAD_ARGUMENT 11
+#define UPDATE_ERROR_ABORT 12
+
+class UpdateClass {
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH, int ledPin = -1, uint8_t ledOn = LOW,
+               const char* label = nullptr);
+    size_t write(uint8_t* data, size_t len);
+    bool end(bool evenIfRemaining = false);
+    void abort();
+    bool hasError() const { return error != UPDATE_ERROR_OK; }
+    uint8_t getError() const { return error; }
+    bool isRunning() const { return file != nullptr; }
+    bool isFinished() const { return finished; }
+    size_t progress() const { return written; }
+    size_t size() const { return expected; }
+    const char* errorString() const;
+    void printError(Print& out) const;
+
+private:
+    FILE* file = nullptr;
+    size_t expected = 0;
+    size_t written = 0;
+    uint8_t error = UPDATE_ERROR_OK;
+    bool finished = false;
+};
+
+extern UpdateClass Update;
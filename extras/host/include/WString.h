@@ -0,0 +1,128 @@
+#pragma once
+
+// Host-Ersatz für die Arduino-String-Klasse (ESP32-Core), auf Basis von std::string.
+// Enthält die Teile der API, die Bibliothek und Beispiele verwenden.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+class String {
+public:
+    String() {}
+    String(const char* cstr) : s(cstr ? cstr : "") {}
+    String(const char* cstr, unsigned int length) : s(cstr ? cstr : "", cstr ? length : 0) {}
+    String(const String& other) = default;
+    String(String&& other) noexcept = default;
+    explicit String(const std::string& str) : s(str) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimalPlaces = 2);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+
+    String& operator=(const String& other) = default;
+    String& operator=(String&& other) noexcept = default;
+    String& operator=(const char* cstr) { s = cstr ? cstr : ""; return *this; }
+
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    unsigned int length() const { return (unsigned int)s.size(); }
+    bool isEmpty() const { return s.empty(); }
+    const char* c_str() const { return s.c_str(); }
+    char* begin() { return &s[0]; }
+    char* end() { return &s[0] + s.size(); }
+    const char* begin() const { return s.data(); }
+    const char* end() const { return s.data() + s.size(); }
+
+    bool concat(const String& str) { s += str.s; return true; }
+    bool concat(const char* cstr) { if (cstr) s += cstr; return cstr != nullptr; }
+    bool concat(const char* cstr, unsigned int length) { if (cstr) s.append(cstr, length); return cstr != nullptr; }
+    bool concat(const uint8_t* data, size_t length) { return concat((const char*)data, (unsigned int)length); }
+    bool concat(char c) { s += c; return true; }
+    bool concat(unsigned char value) { return concat(String(value)); }
+    bool concat(int value) { return concat(String(value)); }
+    bool concat(unsigned int value) { return concat(String(value)); }
+    bool concat(long value) { return concat(String(value)); }
+    bool concat(unsigned long value) { return concat(String(value)); }
+    bool concat(long long value) { return concat(String(value)); }
+    bool concat(unsigned long long value) { return concat(String(value)); }
+    bool concat(float value) { return concat(String(value)); }
+    bool concat(double value) { return concat(String(value)); }
+
+    template <typename T>
+    String& operator+=(const T& value) { concat(value); return *this; }
+
+    int compareTo(const String& other) const { return s.compare(other.s); }
+    bool equals(const String& other) const { return s == other.s; }
+    bool equals(const char* cstr) const { return s == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& other) const { return equals(other); }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& other) const { return !equals(other); }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool operator<(const String& other) const { return s < other.s; }
+    bool operator>(const String& other) const { return s > other.s; }
+    bool operator<=(const String& other) const { return s <= other.s; }
+    bool operator>=(const String& other) const { return s >= other.s; }
+    bool startsWith(const String& prefix) const { return startsWith(prefix, 0); }
+    bool startsWith(const String& prefix, unsigned int offset) const;
+    bool endsWith(const String& suffix) const;
+
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    void setCharAt(unsigned int index, char c) { if (index < s.size()) s[index] = c; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index);
+    void getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index = 0) const;
+    void toCharArray(char* buf, unsigned int bufsize, unsigned int index = 0) const {
+        getBytes((unsigned char*)buf, bufsize, index);
+    }
+
+    int indexOf(char c, unsigned int fromIndex = 0) const;
+    int indexOf(const String& str, unsigned int fromIndex = 0) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(char c, unsigned int fromIndex) const;
+    int lastIndexOf(const String& str) const;
+    int lastIndexOf(const String& str, unsigned int fromIndex) const;
+    String substring(unsigned int beginIndex) const { return substring(beginIndex, length()); }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index) { if (index < s.size()) s.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s.size()) s.erase(index, count); }
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+private:
+    std::string s;
+    static char nullChar;
+};
+
+// Wie StringSumHelper im Core: "text" + String(...) + 42 + ...
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char* rhs);
+String operator+(const char* lhs, const String& rhs);
+String operator+(String&& lhs, const String& rhs);
+String operator+(String&& lhs, const char* rhs);
+String operator+(const String& lhs, char rhs);
+String operator+(const String& lhs, unsigned char rhs);
+String operator+(const String& lhs, int rhs);
+String operator+(const String& lhs, unsigned int rhs);
+String operator+(const String& lhs, long rhs);
+String operator+(const String& lhs, unsigned long rhs);
+String operator+(const String& lhs, long long rhs);
+String operator+(const String& lhs, unsigned long long rhs);
+String operator+(const String& lhs, float rhs);
+String operator+(const String& lhs, double rhs);
+inline bool operator==(const char* lhs, const String& rhs) { return rhs == lhs; }
+inline bool operator!=(const char* lhs, const String& rhs) { return rhs != lhs; }
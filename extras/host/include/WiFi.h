@@ -0,0 +1,99 @@
+#pragma once
+
+// Host-Ersatz für WiFi.h: simuliert Station und Access Point.
+// Jede SSID "verbindet" sich nach kurzer Zeit (localIP 127.0.0.1); Ereignisse kommen wie auf dem
+// ESP32 aus einem eigenen Task. hostSetLinkUp(false) simuliert einen Verbindungsabbruch.
+
+#include <Arduino.h>
+#include <functional>
+
+typedef enum { WIFI_OFF = 0, WIFI_STA, WIFI_AP, WIFI_AP_STA } wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_AUTH_OPEN = 0,
+    WIFI_AUTH_WEP,
+    WIFI_AUTH_WPA_PSK,
+    WIFI_AUTH_WPA2_PSK,
+    WIFI_AUTH_WPA_WPA2_PSK,
+    WIFI_AUTH_WPA2_ENTERPRISE,
+    WIFI_AUTH_WPA3_PSK
+} wifi_auth_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_READY = 0,
+    ARDUINO_EVENT_WIFI_SCAN_DONE,
+    ARDUINO_EVENT_WIFI_STA_START,
+    ARDUINO_EVENT_WIFI_STA_STOP,
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+    ARDUINO_EVENT_WIFI_STA_LOST_IP,
+    ARDUINO_EVENT_WIFI_AP_START,
+    ARDUINO_EVENT_WIFI_AP_STOP,
+    ARDUINO_EVENT_MAX = 64
+} arduino_event_id_t;
+typedef arduino_event_id_t WiFiEvent_t;
+
+typedef union {
+    struct { uint8_t ssid[33]; uint8_t ssid_len; uint8_t bssid[6]; uint8_t reason; } wifi_sta_disconnected;
+    struct { struct { struct { uint32_t addr; } ip, netmask, gw; } ip_info; bool ip_changed; } got_ip;
+} arduino_event_info_t;
+typedef arduino_event_info_t WiFiEventInfo_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef std::function<void(arduino_event_id_t event, arduino_event_info_t info)> WiFiEventFuncCb;
+typedef int wifi_event_id_t;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode);
+    wifi_mode_t getMode();
+    wl_status_t status();
+
+    wl_status_t begin(const char* ssid, const char* passphrase = nullptr);
+    bool disconnect(bool wifioff = false, bool eraseap = false);
+    bool config(IPAddress localIP, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress());
+    bool setHostname(const char* hostname);
+    const char* getHostname();
+    bool setAutoReconnect(bool autoReconnect);
+
+    bool softAP(const char* ssid, const char* passphrase = nullptr);
+    IPAddress softAPIP();
+
+    IPAddress localIP();
+    String SSID();
+    int8_t RSSI();
+    String macAddress();
+
+    int16_t scanNetworks(bool async = false);
+    String SSID(uint8_t index);
+    int32_t RSSI(uint8_t index);
+    wifi_auth_mode_t encryptionType(uint8_t index);
+    void scanDelete() {}
+
+    int hostByName(const char* host, IPAddress& result);
+
+    wifi_event_id_t onEvent(WiFiEventCb callback, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+    wifi_event_id_t onEvent(WiFiEventFuncCb callback, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+    void removeEvent(wifi_event_id_t id);
+
+    // Nur Host: Access Point in Reichweite (true) oder weg (false)
+    void hostSetLinkUp(bool up);
+    bool hostLinkUp();
+    // Nur Host: count weitere (erfundene) Netze im Scan-Ergebnis, z.B. für lange SSID-Listen
+    void hostSetExtraNetworks(uint8_t count);
+};
+
+extern WiFiClass WiFi;
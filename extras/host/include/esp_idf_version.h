@@ -0,0 +1,6 @@
+#pragma once
+
+// Der Host-Ersatz bildet die NVS-Iterator-API von ESP-IDF 5 nach
+#define ESP_IDF_VERSION_MAJOR 5
+#define ESP_IDF_VERSION_MINOR 1
+#define ESP_IDF_VERSION_PATCH 0
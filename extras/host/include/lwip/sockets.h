@@ -0,0 +1,8 @@
+#pragma once
+
+// lwIP bietet die BSD-Socket-API - auf dem Host direkt die POSIX-Sockets
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
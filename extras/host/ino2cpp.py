@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Wandelt einen Arduino-Sketch (.ino) in C++ um, wie es die Arduino-IDE vor dem Kompilieren tut:
+#include <Arduino.h> voranstellen und Prototypen fuer alle Funktionen auf oberster Ebene
+nach den #includes einfuegen, damit sie vor ihrer Definition aufgerufen werden koennen.
+
+    python3 ino2cpp.py Sketch.ino > sketch.cpp
+"""
+
+import re
+import sys
+
+# Funktionsdefinition ab Spalte 0: Rueckgabetyp, Name, Parameter, oeffnende Klammer
+DEFINITION = re.compile(r"^((?:[A-Za-z_][\w:<>,\*&]*\s+)+?[\*&]?)([A-Za-z_]\w*)\s*\(([^;{}()]*)\)\s*\{", re.M)
+KEYWORDS = {"if", "for", "while", "switch", "return", "else", "do"}
+
+
+def main():
+    path = sys.argv[1]
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+
+    prototypes = []
+    for m in DEFINITION.finditer(source):
+        ret, name, params = m.group(1).strip(), m.group(2), " ".join(m.group(3).split())
+        if name in KEYWORDS or ret.split()[-1] in KEYWORDS:
+            continue
+        proto = "%s %s(%s);" % (ret, name, params)
+        if proto not in prototypes:
+            prototypes.append(proto)
+
+    # Prototypen hinter der letzten #include-Zeile einfuegen
+    lines = source.split("\n")
+    last_include = max((i for i, l in enumerate(lines) if l.lstrip().startswith("#include")), default=-1)
+    out = ["#include <Arduino.h>", '#line 1 "%s"' % path]
+    out += lines[:last_include + 1]
+    out += prototypes
+    out.append('#line %d "%s"' % (last_include + 2, path))
+    out += lines[last_include + 1:]
+    sys.stdout.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
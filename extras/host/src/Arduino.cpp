@@ -0,0 +1,234 @@
+#include <Arduino.h>
+#include <HostRuntime.h>
+#include <esp_app_desc.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <malloc.h>
+#include <arpa/inet.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// Heap-Größe eines ESP32 ohne PSRAM nach dem Start von WLAN und Webserver (ca.)
+static const uint32_t HOST_HEAP_SIZE = 300 * 1024;
+
+namespace {
+    const auto startTime = std::chrono::steady_clock::now();
+    std::mutex serialLock;
+    std::mt19937 rng(12345);
+    std::mutex rngLock;
+    std::mutex heapLock;
+    size_t heapBaseline = 0;
+    uint32_t heapMinFree = HOST_HEAP_SIZE;
+
+    std::atomic<bool> virtualTime(false);
+    std::atomic<uint64_t> virtualUs(0);
+
+    std::string dataDirectory = "host-data";
+    uint16_t httpPortNumber = 8080;
+    std::vector<std::string> commandLine;
+}
+
+namespace HostRuntime {
+    void setDataDir(const std::string& dir) { dataDirectory = dir; }
+    const std::string& dataDir() { return dataDirectory; }
+    void setHttpPort(uint16_t port) { httpPortNumber = port; }
+    uint16_t httpPort() { return httpPortNumber; }
+    void setCommandLine(int argc, char** argv) { commandLine.assign(argv, argv + argc); }
+
+    uint64_t monotonicUs() {
+        if (virtualTime) return virtualUs;
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    void useVirtualTime() {
+        virtualUs = monotonicUs();
+        virtualTime = true;
+    }
+
+    void advanceTime(uint64_t us) { virtualUs += us; }
+}
+
+unsigned long millis() {
+    return (unsigned long)(HostRuntime::monotonicUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)HostRuntime::monotonicUs();
+}
+
+void delay(unsigned long ms) {
+    if (virtualTime) HostRuntime::advanceTime((uint64_t)ms * 1000);
+    else std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t) {
+    return HIGH;
+}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+long random(long max) {
+    return max > 0 ? random(0, max) : 0;
+}
+
+long random(long min, long max) {
+    if (max <= min) return min;
+    std::lock_guard<std::mutex> guard(rngLock);
+    return min + (long)(rng() % (unsigned long)(max - min));
+}
+
+void randomSeed(unsigned long seed) {
+    std::lock_guard<std::mutex> guard(rngLock);
+    rng.seed(seed);
+}
+
+extern "C" uint32_t esp_random() {
+    static std::random_device device;
+    std::lock_guard<std::mutex> guard(rngLock);
+    return device();
+}
+
+extern "C" const char* esp_err_to_name(esp_err_t code) {
+    switch (code) {
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        default: return "ESP_ERR_UNKNOWN";
+    }
+}
+
+// Auf dem Host ist das "Image" das wwm-host-Binary; Datum und Zeit stammen aus dieser Datei
+extern "C" const esp_app_desc_t* esp_app_get_description(void) {
+    static const esp_app_desc_t desc = {0xABCD5432, 0, {0, 0}, "host", "wwm-host", __TIME__, __DATE__, "host", {0}, {0}};
+    return &desc;
+}
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+}
+
+size_t Print::write(const char* str) {
+    return str ? write((const uint8_t*)str, strlen(str)) : 0;
+}
+
+size_t Print::printf(const char* format, ...) {
+    char stackBuf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(stackBuf, sizeof(stackBuf), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    if ((size_t)len < sizeof(stackBuf)) return write((const uint8_t*)stackBuf, len);
+
+    std::vector<char> buf(len + 1);
+    va_start(args, format);
+    vsnprintf(buf.data(), buf.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)buf.data(), len);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    std::lock_guard<std::mutex> guard(serialLock);
+    size_t n = fwrite(buffer, 1, size, stdout);
+    fflush(stdout);
+    return n;
+}
+
+IPAddress& IPAddress::operator=(uint32_t address) {
+    memcpy(octets, &address, 4);
+    return *this;
+}
+
+IPAddress::operator uint32_t() const {
+    uint32_t address;
+    memcpy(&address, octets, 4);
+    return address;
+}
+
+bool IPAddress::fromString(const char* address) {
+    struct in_addr parsed;
+    if (!address || inet_pton(AF_INET, address, &parsed) != 1) return false;
+    *this = (uint32_t)parsed.s_addr;
+    return true;
+}
+
+String IPAddress::toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(buf);
+}
+
+static uint32_t heapUsed() {
+    struct mallinfo2 info = mallinfo2();
+    std::lock_guard<std::mutex> guard(heapLock);
+    if (heapBaseline == 0) heapBaseline = info.uordblks;
+    size_t used = info.uordblks > heapBaseline ? info.uordblks - heapBaseline : 0;
+    return used > HOST_HEAP_SIZE ? HOST_HEAP_SIZE : (uint32_t)used;
+}
+
+uint32_t EspClass::getHeapSize() {
+    return HOST_HEAP_SIZE;
+}
+
+uint32_t EspClass::getFreeHeap() {
+    uint32_t freeHeap = HOST_HEAP_SIZE - heapUsed();
+    std::lock_guard<std::mutex> guard(heapLock);
+    if (freeHeap < heapMinFree) heapMinFree = freeHeap;
+    return freeHeap;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    getFreeHeap();
+    std::lock_guard<std::mutex> guard(heapLock);
+    return heapMinFree;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return getFreeHeap();
+}
+
+uint64_t EspClass::getEfuseMac() {
+    return 0x0000A1B2C3D4E5F6ULL;
+}
+
+esp_reset_reason_t esp_reset_reason() {
+    return getenv("WWM_HOST_RESTARTED") ? ESP_RST_SW : ESP_RST_POWERON;
+}
+
+void EspClass::restart() {
+    Serial.println("[host] ESP.restart() - Programm wird neu gestartet");
+    if (commandLine.empty()) exit(0);
+    setenv("WWM_HOST_RESTARTED", "1", 1);
+
+    // Offene Sockets (Webserver, DNS, NTP) nicht an den neuen Prozess vererben
+    for (int fd = 3; fd < 1024; fd++) fcntl(fd, F_SETFD, FD_CLOEXEC);
+    std::vector<char*> args;
+    for (auto& arg : commandLine) args.push_back(&arg[0]);
+    args.push_back(nullptr);
+    execv("/proc/self/exe", args.data());
+    perror("execv");
+    exit(1);
+}
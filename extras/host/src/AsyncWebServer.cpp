@@ -0,0 +1,762 @@
+#include <ESPAsyncWebServer.h>
+#include <HostRuntime.h>
+
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    // Nutzlast eines TCP-Segments; so viel fordert der Original-Server pro Füllrunde höchstens an
+    const size_t SEGMENT_SIZE = 1436;
+    // Abstand der AsyncTCP-Poll-Ticks, an denen RESPONSE_TRY_AGAIN erneut versucht wird
+    const auto POLL_INTERVAL = std::chrono::milliseconds(500);
+    // Verbindungen ohne vollständige Anfrage werden danach geschlossen (wie der Rx-Timeout)
+    const auto RX_TIMEOUT = std::chrono::seconds(30);
+    const size_t MAX_HEAD_SIZE = 16 * 1024;
+
+    bool isParamChar(char c) {
+        return c && c != '{' && c != '[' && c != '&' && c != '=';
+    }
+
+    int hexValue(char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    String urlDecode(const std::string& text) {
+        std::string out;
+        out.reserve(text.size());
+        for (size_t i = 0; i < text.size(); i++) {
+            char c = text[i];
+            if (c == '+') {
+                out += ' ';
+            } else if (c == '%' && i + 2 < text.size() && hexValue(text[i + 1]) >= 0 && hexValue(text[i + 2]) >= 0) {
+                out += (char)(hexValue(text[i + 1]) * 16 + hexValue(text[i + 2]));
+                i += 2;
+            } else {
+                out += c;
+            }
+        }
+        return String(out);
+    }
+
+    std::string trimmed(const std::string& text) {
+        size_t first = text.find_first_not_of(" \t");
+        if (first == std::string::npos) return std::string();
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    const char* reasonPhrase(int code) {
+        switch (code) {
+            case 100: return "Continue";
+            case 200: return "OK";
+            case 201: return "Created";
+            case 204: return "No Content";
+            case 206: return "Partial Content";
+            case 301: return "Moved Permanently";
+            case 302: return "Found";
+            case 303: return "See Other";
+            case 304: return "Not Modified";
+            case 307: return "Temporary Redirect";
+            case 400: return "Bad Request";
+            case 401: return "Unauthorized";
+            case 403: return "Forbidden";
+            case 404: return "Not Found";
+            case 405: return "Method Not Allowed";
+            case 409: return "Conflict";
+            case 413: return "Payload Too Large";
+            case 416: return "Range Not Satisfiable";
+            case 429: return "Too Many Requests";
+            case 500: return "Internal Server Error";
+            case 501: return "Not Implemented";
+            case 503: return "Service Unavailable";
+            default: return "";
+        }
+    }
+
+    WebRequestMethodComposite parseMethod(const std::string& method) {
+        if (method == "GET") return HTTP_GET;
+        if (method == "POST") return HTTP_POST;
+        if (method == "DELETE") return HTTP_DELETE;
+        if (method == "PUT") return HTTP_PUT;
+        if (method == "PATCH") return HTTP_PATCH;
+        if (method == "HEAD") return HTTP_HEAD;
+        if (method == "OPTIONS") return HTTP_OPTIONS;
+        return 0;
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Antwort
+
+AsyncWebServerResponse::AsyncWebServerResponse(int code, const String& contentType, Kind kind)
+    : _code(code), _contentType(contentType), _kind(kind) {}
+
+// ---------------------------------------------------------------------------
+// Anfrage
+
+AsyncWebServerRequest::~AsyncWebServerRequest() {
+    if (_tempObject) free(_tempObject);
+}
+
+const char* AsyncWebServerRequest::methodToString() const {
+    switch (_method) {
+        case HTTP_GET: return "GET";
+        case HTTP_POST: return "POST";
+        case HTTP_DELETE: return "DELETE";
+        case HTTP_PUT: return "PUT";
+        case HTTP_PATCH: return "PATCH";
+        case HTTP_HEAD: return "HEAD";
+        case HTTP_OPTIONS: return "OPTIONS";
+        default: return "UNKNOWN";
+    }
+}
+
+bool AsyncWebServerRequest::hasHeader(const String& name) const {
+    return getHeader(name) != nullptr;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
+    for (const auto& h : _headers) {
+        if (h->name().equalsIgnoreCase(name)) return h.get();
+    }
+    return nullptr;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::getHeader(size_t index) const {
+    return index < _headers.size() ? _headers[index].get() : nullptr;
+}
+
+String AsyncWebServerRequest::header(const char* name) const {
+    AsyncWebHeader* h = getHeader(String(name));
+    return h ? h->value() : String();
+}
+
+bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const {
+    return getParam(name, post, file) != nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const {
+    for (const auto& p : _params) {
+        if (p->name() == name && p->isPost() == post && p->isFile() == file) return p.get();
+    }
+    return nullptr;
+}
+
+AsyncWebParameter* AsyncWebServerRequest::getParam(size_t index) const {
+    return index < _params.size() ? _params[index].get() : nullptr;
+}
+
+bool AsyncWebServerRequest::hasArg(const char* name) const {
+    for (const auto& p : _params) {
+        if (p->name() == name) return true;
+    }
+    return false;
+}
+
+const String& AsyncWebServerRequest::arg(const String& name) const {
+    static const String empty;
+    for (const auto& p : _params) {
+        if (p->name() == name) return p->value();
+    }
+    return empty;
+}
+
+void AsyncWebServerRequest::send(AsyncWebServerResponse* response) {
+    _response.reset(response);
+    _sent = true;
+}
+
+void AsyncWebServerRequest::send(int code, const String& contentType, const String& content) {
+    send(beginResponse(code, contentType, content));
+}
+
+void AsyncWebServerRequest::redirect(const String& url) {
+    AsyncWebServerResponse* response = beginResponse(302);
+    response->addHeader("Location", url);
+    send(response);
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(int code, const String& contentType,
+                                                             const String& content) {
+    auto* response = new AsyncWebServerResponse(code, contentType, AsyncWebServerResponse::Kind::Basic);
+    response->_content.assign(content.c_str(), content.length());
+    response->_contentLength = content.length();
+    return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse(const String& contentType, size_t len,
+                                                             AwsResponseFiller callback, AwsTemplateProcessor) {
+    auto* response = new AsyncWebServerResponse(200, contentType, AsyncWebServerResponse::Kind::Callback);
+    response->_contentLength = len;
+    response->_filler = callback;
+    return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginChunkedResponse(const String& contentType,
+                                                                    AwsResponseFiller callback,
+                                                                    AwsTemplateProcessor templateCallback) {
+    // Wie im Original: HTTP/1.0 kennt kein Chunked Encoding, daraus wird eine Antwort der Länge 0
+    if (!_version) return beginResponse(contentType, 0, callback, templateCallback);
+    auto* response = new AsyncWebServerResponse(200, contentType, AsyncWebServerResponse::Kind::Chunked);
+    response->_filler = callback;
+    return response;
+}
+
+AsyncWebServerResponse* AsyncWebServerRequest::beginResponse_P(int code, const String& contentType,
+                                                               const uint8_t* content, size_t len,
+                                                               AwsTemplateProcessor) {
+    auto* response = new AsyncWebServerResponse(code, contentType, AsyncWebServerResponse::Kind::Basic);
+    response->_content.assign((const char*)content, len);
+    response->_contentLength = len;
+    return response;
+}
+
+// ---------------------------------------------------------------------------
+// Handler
+
+bool AsyncCallbackWebHandler::canHandle(AsyncWebServerRequest* request) const {
+    if (!(_method & request->method())) return false;
+    const String& url = request->url();
+    if (_uri.length() && _uri.startsWith("/*.")) {
+        if (!url.endsWith(_uri.substring(_uri.lastIndexOf('.')))) return false;
+    } else if (_uri.length() && _uri.endsWith("*")) {
+        if (!url.startsWith(_uri.substring(0, _uri.length() - 1))) return false;
+    } else if (_uri.length() && _uri != url && !url.startsWith(_uri + "/")) {
+        return false;
+    }
+    return !_filter || _filter(request);
+}
+
+// ---------------------------------------------------------------------------
+// Server
+
+struct AsyncWebServer::Connection {
+    enum class State { Head, Body, Sending, Closing };
+
+    int fd = -1;
+    State state = State::Head;
+    Clock::time_point lastActivity = Clock::now();
+    std::string in;
+    std::string out;
+    std::unique_ptr<AsyncWebServerRequest> request;
+    AsyncCallbackWebHandler* handler = nullptr;
+
+    // Body
+    size_t received = 0;
+    bool plainPost = false;
+    bool multipart = false;
+    std::string boundary;
+    std::string body;
+
+    // Antwort
+    bool headSent = false;
+    bool finished = false;
+    size_t sentBody = 0;
+    Clock::time_point retryAt;
+};
+
+AsyncWebServer::AsyncWebServer(uint16_t port) : _port(port) {}
+
+AsyncWebServer::~AsyncWebServer() {
+    end();
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, ArRequestHandlerFunction onRequest) {
+    return on(uri, HTTP_ANY, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest) {
+    return on(uri, method, onRequest, nullptr, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload) {
+    return on(uri, method, onRequest, onUpload, nullptr);
+}
+
+AsyncCallbackWebHandler& AsyncWebServer::on(const char* uri, WebRequestMethodComposite method,
+                                            ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload,
+                                            ArBodyHandlerFunction onBody) {
+    std::unique_ptr<AsyncCallbackWebHandler> handler(new AsyncCallbackWebHandler());
+    handler->_uri = uri;
+    handler->_method = method;
+    handler->_onRequest = onRequest;
+    handler->_onUpload = onUpload;
+    handler->_onBody = onBody;
+    std::lock_guard<std::mutex> guard(_lock);
+    _handlers.push_back(std::move(handler));
+    return *_handlers.back();
+}
+
+void AsyncWebServer::reset() {
+    std::lock_guard<std::mutex> guard(_lock);
+    _handlers.clear();
+    _notFound = nullptr;
+}
+
+void AsyncWebServer::begin() {
+    if (_running) return;
+    uint16_t port = HostRuntime::httpPort();
+    _listenFd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    int one = 1;
+    setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(_listenFd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(_listenFd, 16) < 0) {
+        Serial.printf("[host] Webserver: Port %u nicht verfügbar (%s)\n", port, strerror(errno));
+        close(_listenFd);
+        _listenFd = -1;
+        return;
+    }
+    if (pipe2(_wakeFds, O_NONBLOCK | O_CLOEXEC) < 0) {
+        close(_listenFd);
+        _listenFd = -1;
+        return;
+    }
+    Serial.printf("[host] Webserver (Port %u auf dem Gerät) lauscht auf http://127.0.0.1:%u/\n", _port, port);
+    _running = true;
+    _thread.reset(new std::thread(&AsyncWebServer::run, this));
+}
+
+void AsyncWebServer::end() {
+    if (!_running) return;
+    _running = false;
+    char c = 0;
+    if (write(_wakeFds[1], &c, 1) < 0) {}
+    if (_thread && _thread->joinable()) _thread->join();
+    _thread.reset();
+    for (auto& conn : _connections) {
+        if (conn->request && conn->request->_onDisconnect) conn->request->_onDisconnect();
+        close(conn->fd);
+    }
+    _connections.clear();
+    close(_listenFd);
+    close(_wakeFds[0]);
+    close(_wakeFds[1]);
+    _listenFd = _wakeFds[0] = _wakeFds[1] = -1;
+}
+
+AsyncCallbackWebHandler* AsyncWebServer::findHandler(AsyncWebServerRequest* request) {
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto& handler : _handlers) {
+        if (handler->canHandle(request)) return handler.get();
+    }
+    return nullptr;
+}
+
+void AsyncWebServer::run() {
+    while (_running) {
+        auto now = Clock::now();
+        auto wakeAt = now + POLL_INTERVAL;
+
+        // Wartende Callback-Antworten erst am nächsten Poll-Tick erneut füllen
+        for (auto& conn : _connections) {
+            if (conn->state == Connection::State::Sending && conn->out.empty() && !conn->finished) {
+                if (conn->retryAt <= now) fill(*conn);
+                if (!conn->finished && conn->out.empty() && conn->retryAt < wakeAt) wakeAt = conn->retryAt;
+            }
+        }
+
+        std::vector<struct pollfd> fds;
+        fds.push_back({_listenFd, POLLIN, 0});
+        fds.push_back({_wakeFds[0], POLLIN, 0});
+        for (auto& conn : _connections) {
+            short events = 0;
+            if (conn->state == Connection::State::Head || conn->state == Connection::State::Body) events |= POLLIN;
+            if (!conn->out.empty()) events |= POLLOUT;
+            fds.push_back({conn->fd, events, 0});
+        }
+
+        int timeoutMs = (int)std::chrono::duration_cast<std::chrono::milliseconds>(wakeAt - Clock::now()).count();
+        if (poll(fds.data(), fds.size(), timeoutMs < 0 ? 0 : timeoutMs) < 0 && errno != EINTR) break;
+        if (!_running) break;
+
+        if (fds[0].revents & POLLIN) accept();
+
+        for (size_t i = 0; i < _connections.size(); i++) {
+            Connection& conn = *_connections[i];
+            short revents = i + 2 < fds.size() && fds[i + 2].fd == conn.fd ? fds[i + 2].revents : 0;
+            bool keep = true;
+            if (revents & (POLLIN | POLLHUP | POLLERR)) keep = receive(conn);
+            if (keep && (revents & POLLOUT)) keep = transmit(conn);
+            if (keep && conn.finished && conn.out.empty()) keep = false;
+            if (keep && (conn.state == Connection::State::Head || conn.state == Connection::State::Body) &&
+                Clock::now() - conn.lastActivity > RX_TIMEOUT) {
+                keep = false;
+            }
+            if (!keep) conn.state = Connection::State::Closing;
+        }
+
+        for (auto it = _connections.begin(); it != _connections.end();) {
+            if ((*it)->state != Connection::State::Closing) {
+                ++it;
+                continue;
+            }
+            Connection& conn = **it;
+            if (conn.request && conn.request->_onDisconnect) conn.request->_onDisconnect();
+            shutdown(conn.fd, SHUT_RDWR);
+            close(conn.fd);
+            it = _connections.erase(it);
+        }
+    }
+}
+
+void AsyncWebServer::accept() {
+    for (;;) {
+        int fd = accept4(_listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        std::unique_ptr<Connection> conn(new Connection());
+        conn->fd = fd;
+        conn->request.reset(new AsyncWebServerRequest());
+        _connections.push_back(std::move(conn));
+    }
+}
+
+bool AsyncWebServer::receive(Connection& conn) {
+    uint8_t buf[4096];
+    for (;;) {
+        ssize_t n = recv(conn.fd, buf, sizeof(buf), 0);
+        if (n == 0) return conn.state == Connection::State::Sending && !conn.out.empty();
+        if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        conn.lastActivity = Clock::now();
+
+        if (conn.state == Connection::State::Head) {
+            conn.in.append((const char*)buf, n);
+            if (conn.in.find("\r\n\r\n") == std::string::npos) {
+                if (conn.in.size() > MAX_HEAD_SIZE) return false;
+                continue;
+            }
+            if (!parseHead(conn)) return false;
+            std::string rest;
+            rest.swap(conn.in);
+            size_t headEnd = rest.find("\r\n\r\n") + 4;
+            if (conn.state == Connection::State::Body && rest.size() > headEnd) {
+                if (!consumeBody(conn, (const uint8_t*)rest.data() + headEnd, rest.size() - headEnd)) return false;
+            }
+        } else if (conn.state == Connection::State::Body) {
+            if (!consumeBody(conn, buf, n)) return false;
+        }
+        // Im Zustand Sending werden weitere Daten des Clients verworfen
+    }
+}
+
+bool AsyncWebServer::parseHead(Connection& conn) {
+    AsyncWebServerRequest& request = *conn.request;
+    size_t headEnd = conn.in.find("\r\n\r\n");
+    size_t lineEnd = conn.in.find("\r\n");
+    std::string requestLine = conn.in.substr(0, lineEnd);
+
+    size_t sp1 = requestLine.find(' ');
+    size_t sp2 = requestLine.rfind(' ');
+    if (sp1 == std::string::npos || sp2 == sp1) return false;
+    request._method = parseMethod(requestLine.substr(0, sp1));
+    if (!request._method) return false;
+    std::string target = requestLine.substr(sp1 + 1, sp2 - sp1 - 1);
+    request._version = requestLine.compare(sp2 + 1, std::string::npos, "HTTP/1.0") == 0 ? 0 : 1;
+
+    size_t query = target.find('?');
+    request._url = urlDecode(target.substr(0, query));
+    if (query != std::string::npos) {
+        std::string params = target.substr(query + 1);
+        size_t start = 0;
+        while (start <= params.size()) {
+            size_t end = params.find('&', start);
+            if (end == std::string::npos) end = params.size();
+            std::string pair = params.substr(start, end - start);
+            if (!pair.empty()) {
+                size_t eq = pair.find('=');
+                std::string name = pair.substr(0, eq);
+                std::string value = eq == std::string::npos ? std::string() : pair.substr(eq + 1);
+                request._params.emplace_back(new AsyncWebParameter(urlDecode(name), urlDecode(value)));
+            }
+            start = end + 1;
+        }
+    }
+
+    bool expectContinue = false;
+    size_t pos = lineEnd + 2;
+    while (pos < headEnd) {
+        size_t end = conn.in.find("\r\n", pos);
+        std::string line = conn.in.substr(pos, end - pos);
+        pos = end + 2;
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) continue;
+        std::string name = trimmed(line.substr(0, colon));
+        std::string value = trimmed(line.substr(colon + 1));
+        String key(name);
+        if (key.equalsIgnoreCase("Host")) {
+            request._host = String(value);
+        } else if (key.equalsIgnoreCase("Content-Type")) {
+            if (value.compare(0, 10, "multipart/") == 0) {
+                size_t eq = value.find("boundary=");
+                if (eq != std::string::npos) {
+                    conn.boundary = value.substr(eq + 9);
+                    conn.boundary.erase(std::remove(conn.boundary.begin(), conn.boundary.end(), '"'),
+                                        conn.boundary.end());
+                }
+                request._contentType = String(value.substr(0, value.find(';')));
+                conn.multipart = true;
+            } else {
+                request._contentType = String(value);
+            }
+        } else if (key.equalsIgnoreCase("Content-Length")) {
+            request._contentLength = strtoul(value.c_str(), nullptr, 10);
+        } else if (key.equalsIgnoreCase("Expect") && value == "100-continue") {
+            expectContinue = true;
+        }
+        request._headers.emplace_back(new AsyncWebHeader(key, String(value)));
+    }
+
+    if (expectContinue) {
+        const char* interim = "HTTP/1.1 100 Continue\r\n\r\n";
+        if (::send(conn.fd, interim, strlen(interim), MSG_NOSIGNAL) < 0) return false;
+    }
+
+    conn.handler = findHandler(&request);
+    if (request._contentLength == 0) {
+        handleRequest(conn);
+    } else {
+        conn.state = Connection::State::Body;
+    }
+    return true;
+}
+
+bool AsyncWebServer::consumeBody(Connection& conn, const uint8_t* data, size_t len) {
+    AsyncWebServerRequest& request = *conn.request;
+    len = std::min(len, request._contentLength - conn.received);
+
+    if (conn.multipart) {
+        conn.body.append((const char*)data, len);
+    } else {
+        if (conn.received == 0) {
+            if (request._contentType.startsWith("application/x-www-form-urlencoded")) {
+                conn.plainPost = true;
+            } else if (request._contentType == "text/plain" && isParamChar((char)data[0])) {
+                size_t i = 0;
+                while (i < len && isParamChar((char)data[i++])) {}
+                if (i < len && data[i - 1] == '=') conn.plainPost = true;
+            }
+        }
+        if (conn.plainPost) {
+            conn.body.append((const char*)data, len);
+        } else if (conn.handler && conn.handler->_onBody) {
+            conn.handler->_onBody(&request, (uint8_t*)data, len, conn.received, request._contentLength);
+        }
+    }
+    conn.received += len;
+    if (conn.received < request._contentLength) return true;
+
+    if (conn.multipart) {
+        parseMultipart(conn);
+    } else if (conn.plainPost) {
+        size_t start = 0;
+        while (start <= conn.body.size()) {
+            size_t end = conn.body.find('&', start);
+            if (end == std::string::npos) end = conn.body.size();
+            std::string item = conn.body.substr(start, end - start);
+            if (!item.empty()) {
+                std::string name = "body";
+                std::string value = item;
+                size_t eq = item.find('=');
+                if (item[0] != '{' && item[0] != '[' && eq != std::string::npos && eq > 0) {
+                    name = item.substr(0, eq);
+                    value = item.substr(eq + 1);
+                }
+                request._params.emplace_back(new AsyncWebParameter(urlDecode(name), urlDecode(value), true));
+            }
+            start = end + 1;
+        }
+    }
+    conn.body.clear();
+    conn.body.shrink_to_fit();
+    handleRequest(conn);
+    return true;
+}
+
+void AsyncWebServer::parseMultipart(Connection& conn) {
+    AsyncWebServerRequest& request = *conn.request;
+    const std::string& body = conn.body;
+    const std::string delimiter = "--" + conn.boundary;
+
+    size_t pos = body.find(delimiter);
+    while (pos != std::string::npos) {
+        pos += delimiter.size();
+        if (body.compare(pos, 2, "--") == 0) break;
+        size_t headStart = pos + 2;
+        size_t headEnd = body.find("\r\n\r\n", headStart);
+        if (headEnd == std::string::npos) break;
+        size_t dataStart = headEnd + 4;
+        size_t next = body.find("\r\n" + delimiter, dataStart);
+        if (next == std::string::npos) break;
+
+        // Content-Disposition: form-data; name="feld"; filename="datei.bin"
+        std::string name;
+        std::string filename;
+        bool hasFilename = false;
+        std::string head = body.substr(headStart, headEnd - headStart);
+        size_t lineStart = 0;
+        while (lineStart < head.size()) {
+            size_t lineEnd = head.find("\r\n", lineStart);
+            if (lineEnd == std::string::npos) lineEnd = head.size();
+            std::string line = head.substr(lineStart, lineEnd - lineStart);
+            lineStart = lineEnd + 2;
+            if (!String(line.substr(0, 20)).equalsIgnoreCase("Content-Disposition:")) continue;
+            size_t start = 20;
+            while (start < line.size()) {
+                size_t end = line.find(';', start);
+                if (end == std::string::npos) end = line.size();
+                std::string token = trimmed(line.substr(start, end - start));
+                start = end + 1;
+                size_t eq = token.find('=');
+                if (eq == std::string::npos) continue;
+                std::string key = token.substr(0, eq);
+                std::string value = token.substr(eq + 1);
+                value.erase(std::remove(value.begin(), value.end(), '"'), value.end());
+                if (key == "name") {
+                    name = value;
+                } else if (key == "filename") {
+                    filename = value;
+                    hasFilename = true;
+                }
+            }
+        }
+
+        size_t size = next - dataStart;
+        if (hasFilename) {
+            // Upload in Segmenten wie AsyncWebServer (index = bisher übergebene Bytes, final beim letzten)
+            size_t index = 0;
+            do {
+                size_t len = std::min(SEGMENT_SIZE, size - index);
+                bool final = index + len >= size;
+                if (conn.handler && conn.handler->_onUpload) {
+                    conn.handler->_onUpload(&request, String(filename), index,
+                                            (uint8_t*)body.data() + dataStart + index, len, final);
+                }
+                index += len;
+            } while (index < size);
+            request._params.emplace_back(new AsyncWebParameter(String(name), String(filename), true, true, size));
+        } else {
+            request._params.emplace_back(
+                new AsyncWebParameter(String(name), String(body.substr(dataStart, size)), true));
+        }
+        pos = next + 2;
+    }
+}
+
+void AsyncWebServer::handleRequest(Connection& conn) {
+    AsyncWebServerRequest* request = conn.request.get();
+    conn.state = Connection::State::Sending;
+    if (conn.handler) {
+        if (conn.handler->_onRequest) conn.handler->_onRequest(request);
+        else request->send(500);
+    } else if (_notFound) {
+        _notFound(request);
+    } else {
+        request->send(404);
+    }
+    if (!request->_sent || !request->_response) {
+        request->send(501, "text/plain", "Handler did not handle the request");
+    }
+    conn.retryAt = Clock::now();
+    fill(conn);
+}
+
+void AsyncWebServer::fill(Connection& conn) {
+    AsyncWebServerRequest& request = *conn.request;
+    AsyncWebServerResponse& response = *request._response;
+    typedef AsyncWebServerResponse::Kind Kind;
+
+    if (!conn.headSent) {
+        char line[64];
+        snprintf(line, sizeof(line), "HTTP/1.%d %d %s\r\n", request._version, response._code,
+                 reasonPhrase(response._code));
+        conn.out += line;
+        if (response._kind != Kind::Chunked) {
+            conn.out += "Content-Length: " + std::to_string(response._contentLength) + "\r\n";
+        }
+        if (response._contentType.length()) {
+            conn.out += std::string("Content-Type: ") + response._contentType.c_str() + "\r\n";
+        }
+        for (const auto& h : response._headers) {
+            conn.out += std::string(h.name().c_str()) + ": " + h.value().c_str() + "\r\n";
+        }
+        conn.out += "Connection: close\r\n";
+        if (response._kind == Kind::Chunked) conn.out += "Transfer-Encoding: chunked\r\n";
+        conn.out += "\r\n";
+        conn.headSent = true;
+    }
+
+    bool head = request._method == HTTP_HEAD;
+    if (response._kind == Kind::Basic) {
+        if (!head) conn.out += response._content;
+        conn.finished = true;
+        return;
+    }
+
+    uint8_t buf[SEGMENT_SIZE];
+    if (response._kind == Kind::Callback) {
+        if (conn.sentBody >= response._contentLength || head) {
+            conn.finished = true;
+            return;
+        }
+        size_t want = std::min(SEGMENT_SIZE, response._contentLength - conn.sentBody);
+        size_t got = response._filler(buf, want, conn.sentBody);
+        if (got == RESPONSE_TRY_AGAIN) {
+            conn.retryAt = Clock::now() + POLL_INTERVAL;
+            return;
+        }
+        if (got == 0 || got > want) {
+            // Quelle versiegt vor der angekündigten Länge: wie im Original Verbindung beenden
+            conn.finished = true;
+            return;
+        }
+        conn.out.append((const char*)buf, got);
+        conn.sentBody += got;
+        if (conn.sentBody >= response._contentLength) conn.finished = true;
+        return;
+    }
+
+    // Chunked: 8 Bytes je Segment für Längenzeile und CRLF reservieren
+    size_t got = response._filler(buf, SEGMENT_SIZE - 8, conn.sentBody);
+    if (got == RESPONSE_TRY_AGAIN) {
+        conn.retryAt = Clock::now() + POLL_INTERVAL;
+        return;
+    }
+    char size[16];
+    snprintf(size, sizeof(size), "%zx\r\n", got);
+    conn.out += size;
+    if (got) {
+        conn.out.append((const char*)buf, std::min(got, SEGMENT_SIZE - 8));
+        conn.out += "\r\n";
+        conn.sentBody += got;
+    } else {
+        conn.out += "\r\n";
+        conn.finished = true;
+    }
+}
+
+bool AsyncWebServer::transmit(Connection& conn) {
+    while (!conn.out.empty()) {
+        ssize_t n = ::send(conn.fd, conn.out.data(), conn.out.size(), MSG_NOSIGNAL);
+        if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        conn.out.erase(0, n);
+        if (conn.out.empty() && !conn.finished && conn.retryAt <= Clock::now()) fill(conn);
+    }
+    return true;
+}
@@ -0,0 +1,103 @@
+// Simulierte Systemuhr des ESP32 (per -Wl,--wrap im Makefile auf die Bibliothek umgebogen).
+//
+// Sie startet wie auf dem Gerät bei 1970-01-01, damit der SNTP-Client denselben ersten Schritt
+// sieht; settimeofday()/adjtime() verstellen nur diese Uhr, nie die des Hosts. adjtime() wird
+// wie bei lwIP/newlib mit höchstens 500 ppm eingeschwenkt. Grundlage ist HostRuntime::monotonicUs(),
+// in Tests also auch virtuelle Zeit, optional mit Gangabweichung (setClockDriftPpm()).
+
+#include <HostRuntime.h>
+
+#include <mutex>
+#include <stdint.h>
+#include <sys/time.h>
+#include <time.h>
+
+namespace {
+    const int64_t SLEW_PPM = 500;
+
+    std::mutex lock;
+    bool initialised = false;
+    int64_t offsetUs = 0;        // simulierte Zeit - Host-Zeit
+    int64_t slewPendingUs = 0;   // noch einzuschwenkender Rest aus adjtime()
+    int64_t slewSinceUs = 0;     // Host-Zeit der letzten Abrechnung
+    double driftPpm = 0;
+    int64_t driftSinceUs = 0;    // Ab hier gilt driftPpm (Host-Zeit ohne Drift)
+    int64_t driftBaseUs = 0;     // Aufgelaufene Drift bis dahin
+
+    int64_t driftedUs(int64_t us) {
+        return us + driftBaseUs + (int64_t)((us - driftSinceUs) * driftPpm / 1000000);
+    }
+
+    int64_t hostNowUs() {
+        return driftedUs((int64_t)HostRuntime::monotonicUs());
+    }
+
+    // Offset bis 'now' fortschreiben; Aufrufer hält 'lock'
+    int64_t settle(int64_t now) {
+        if (!initialised) {
+            offsetUs = -now;
+            slewSinceUs = now;
+            initialised = true;
+        }
+        if (slewPendingUs != 0) {
+            int64_t budget = (now - slewSinceUs) * SLEW_PPM / 1000000;
+            int64_t step = slewPendingUs > 0 ? (slewPendingUs < budget ? slewPendingUs : budget)
+                                             : (-slewPendingUs < budget ? slewPendingUs : -budget);
+            offsetUs += step;
+            slewPendingUs -= step;
+        }
+        slewSinceUs = now;
+        return now + offsetUs;
+    }
+}
+
+void HostRuntime::setClockDriftPpm(double ppm) {
+    std::lock_guard<std::mutex> guard(lock);
+    int64_t now = (int64_t)HostRuntime::monotonicUs();
+    driftBaseUs = driftedUs(now) - now;
+    driftSinceUs = now;
+    driftPpm = ppm;
+}
+
+extern "C" {
+
+int __wrap_gettimeofday(struct timeval* tv, void* tz) {
+    (void)tz;
+    if (!tv) return 0;
+    std::lock_guard<std::mutex> guard(lock);
+    int64_t us = settle(hostNowUs());
+    tv->tv_sec = (time_t)(us / 1000000);
+    tv->tv_usec = (suseconds_t)(us % 1000000);
+    return 0;
+}
+
+time_t __wrap_time(time_t* out) {
+    struct timeval tv;
+    __wrap_gettimeofday(&tv, nullptr);
+    if (out) *out = tv.tv_sec;
+    return tv.tv_sec;
+}
+
+int __wrap_settimeofday(const struct timeval* tv, const struct timezone* tz) {
+    (void)tz;
+    if (!tv) return 0;
+    std::lock_guard<std::mutex> guard(lock);
+    int64_t now = hostNowUs();
+    settle(now);
+    offsetUs = (int64_t)tv->tv_sec * 1000000 + tv->tv_usec - now;
+    slewPendingUs = 0;
+    return 0;
+}
+
+int __wrap_adjtime(const struct timeval* delta, struct timeval* olddelta) {
+    std::lock_guard<std::mutex> guard(lock);
+    settle(hostNowUs());
+    if (olddelta) {
+        olddelta->tv_sec = (time_t)(slewPendingUs / 1000000);
+        olddelta->tv_usec = (suseconds_t)(slewPendingUs % 1000000);
+    }
+    if (delta) slewPendingUs = (int64_t)delta->tv_sec * 1000000 + delta->tv_usec;
+    return 0;
+}
+
+}
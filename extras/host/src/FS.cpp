@@ -0,0 +1,144 @@
+#include <FS.h>
+#include <LittleFS.h>
+#include <HostRuntime.h>
+
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+fs::LittleFSFS LittleFS;
+
+namespace fs {
+
+File::File(FILE* file, const String& path, bool isDir)
+    : handle(file, [](FILE* f) { if (f) fclose(f); }), filePath(path), directory(isDir) {
+    int slash = path.lastIndexOf('/');
+    fileName = slash >= 0 ? path.substring(slash + 1) : path;
+}
+
+size_t File::write(uint8_t c) {
+    return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+    return handle ? fwrite(buf, 1, size, handle.get()) : 0;
+}
+
+int File::available() {
+    if (!handle) return 0;
+    return (int)(size() - position());
+}
+
+int File::read() {
+    if (!handle) return -1;
+    return fgetc(handle.get());
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+    return handle ? fread(buf, 1, size, handle.get()) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!handle) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+    return fseek(handle.get(), pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!handle) return 0;
+    long pos = ftell(handle.get());
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+    if (!handle) return 0;
+    struct stat st;
+    fflush(handle.get());
+    if (fstat(fileno(handle.get()), &st) != 0) return 0;
+    return (size_t)st.st_size;
+}
+
+void File::close() {
+    handle.reset();
+    directory = false;
+}
+
+time_t File::getLastWrite() {
+    if (!handle) return 0;
+    struct stat st;
+    if (fstat(fileno(handle.get()), &st) != 0) return 0;
+    return st.st_mtime;
+}
+
+const char* File::name() const {
+    return fileName.c_str();
+}
+
+std::string FS::root() const {
+    return HostRuntime::dataDir() + "/" + subdirectory;
+}
+
+std::string FS::hostPath(const char* path) const {
+    std::string p = path ? path : "";
+    // Pfade mit ".." dürfen das Datenverzeichnis nicht verlassen
+    if (p.find("..") != std::string::npos) return std::string();
+    if (p.empty() || p[0] != '/') p = "/" + p;
+    return root() + p;
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+    if (!mounted) return File();
+    std::string host = hostPath(path);
+    if (host.empty()) return File();
+    struct stat st;
+    if (stat(host.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) return File(nullptr, String(path), true);
+    if (create && mode[0] != 'r') {
+        for (size_t slash = host.find('/', root().size() + 1); slash != std::string::npos;
+             slash = host.find('/', slash + 1)) {
+            ::mkdir(host.substr(0, slash).c_str(), 0755);
+        }
+    }
+    std::string m = mode;
+    if (m.find('b') == std::string::npos) m += 'b';
+    FILE* file = fopen(host.c_str(), m.c_str());
+    if (!file) return File();
+    return File(file, String(path), false);
+}
+
+bool FS::exists(const char* path) {
+    if (!mounted) return false;
+    std::string host = hostPath(path);
+    struct stat st;
+    return !host.empty() && stat(host.c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+    if (!mounted) return false;
+    std::string host = hostPath(path);
+    return !host.empty() && ::remove(host.c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+    if (!mounted) return false;
+    std::string host = hostPath(path);
+    return !host.empty() && (::mkdir(host.c_str(), 0755) == 0 || errno == EEXIST);
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles, const char* partitionLabel) {
+    (void)formatOnFail;
+    (void)basePath;
+    (void)maxOpenFiles;
+    (void)partitionLabel;
+    ::mkdir(HostRuntime::dataDir().c_str(), 0755);
+    if (::mkdir(root().c_str(), 0755) != 0 && errno != EEXIST) return false;
+    mounted = true;
+    return true;
+}
+
+bool LittleFSFS::format() {
+    std::string cmd = "rm -rf '" + root() + "'";
+    if (system(cmd.c_str()) != 0) return false;
+    return ::mkdir(root().c_str(), 0755) == 0;
+}
+
+}
@@ -0,0 +1,325 @@
+#include <nvs.h>
+#include <HostRuntime.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+namespace {
+    struct Entry {
+        nvs_type_t type;
+        std::vector<uint8_t> data;   // Zahlen little-endian, Strings mit abschließender 0
+    };
+    typedef std::map<std::string, Entry> Namespace;
+
+    struct Handle {
+        std::string ns;
+        bool readOnly;
+    };
+
+    std::recursive_mutex lock;
+    std::map<std::string, Namespace> store;
+    std::map<nvs_handle_t, Handle> handles;
+    nvs_handle_t nextHandle = 1;
+    bool loaded = false;
+    bool persistent = true;
+    HostNvsStats stats = {0, 0, 0};
+
+    std::string storePath() {
+        return HostRuntime::dataDir() + "/nvs.txt";
+    }
+
+    std::string toHex(const std::vector<uint8_t>& data) {
+        static const char digits[] = "0123456789abcdef";
+        std::string out;
+        for (uint8_t b : data) {
+            out += digits[b >> 4];
+            out += digits[b & 0x0F];
+        }
+        return out;
+    }
+
+    // Format je Zeile: Namespace <TAB> Schlüssel <TAB> Typ (hex) <TAB> Daten (hex)
+    void load() {
+        if (loaded) return;
+        loaded = true;
+        if (!persistent) return;
+        FILE* f = fopen(storePath().c_str(), "r");
+        if (!f) return;
+        char line[8192];
+        while (fgets(line, sizeof(line), f)) {
+            char* fields[4];
+            char* p = line;
+            int n = 0;
+            for (; n < 4; n++) {
+                fields[n] = p;
+                p = strpbrk(p, "\t\n");
+                if (!p) break;
+                bool last = *p == '\n';
+                *p++ = 0;
+                if (last) {
+                    n++;
+                    break;
+                }
+            }
+            if (n < 4) continue;
+            Entry entry;
+            entry.type = (nvs_type_t)strtoul(fields[2], nullptr, 16);
+            for (const char* h = fields[3]; h[0] && h[1]; h += 2) {
+                char byte[3] = {h[0], h[1], 0};
+                entry.data.push_back((uint8_t)strtoul(byte, nullptr, 16));
+            }
+            store[fields[0]][fields[1]] = entry;
+        }
+        fclose(f);
+    }
+
+    void save() {
+        if (!persistent) return;
+        mkdir(HostRuntime::dataDir().c_str(), 0755);
+        std::string tmp = storePath() + ".tmp";
+        FILE* f = fopen(tmp.c_str(), "w");
+        if (!f) return;
+        for (const auto& ns : store) {
+            for (const auto& item : ns.second) {
+                fprintf(f, "%s\t%s\t%02x\t%s\n", ns.first.c_str(), item.first.c_str(),
+                        (unsigned)item.second.type, toHex(item.second.data).c_str());
+            }
+        }
+        fclose(f);
+        rename(tmp.c_str(), storePath().c_str());
+    }
+
+    esp_err_t checkName(const char* name) {
+        if (!name || !*name) return ESP_ERR_NVS_INVALID_NAME;
+        if (strlen(name) >= NVS_KEY_NAME_MAX_SIZE) return ESP_ERR_NVS_KEY_TOO_LONG;
+        return ESP_OK;
+    }
+
+    Handle* findHandle(nvs_handle_t handle) {
+        auto it = handles.find(handle);
+        return it == handles.end() ? nullptr : &it->second;
+    }
+
+    esp_err_t setItem(nvs_handle_t handle, const char* key, nvs_type_t type, const void* data, size_t len) {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        Handle* h = findHandle(handle);
+        if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+        if (h->readOnly) return ESP_ERR_NVS_READ_ONLY;
+        esp_err_t err = checkName(key);
+        if (err != ESP_OK) return err;
+        stats.writes++;
+        Entry& entry = store[h->ns][key];
+        entry.type = type;
+        entry.data.assign((const uint8_t*)data, (const uint8_t*)data + len);
+        save();
+        return ESP_OK;
+    }
+
+    esp_err_t getItem(nvs_handle_t handle, const char* key, nvs_type_t type, const Entry** out) {
+        Handle* h = findHandle(handle);
+        if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+        stats.reads++;
+        esp_err_t err = checkName(key);
+        if (err != ESP_OK) return err;
+        auto ns = store.find(h->ns);
+        if (ns == store.end()) return ESP_ERR_NVS_NOT_FOUND;
+        auto it = ns->second.find(key);
+        if (it == ns->second.end() || it->second.type != type) return ESP_ERR_NVS_NOT_FOUND;
+        *out = &it->second;
+        return ESP_OK;
+    }
+
+    template <typename T>
+    esp_err_t getNumber(nvs_handle_t handle, const char* key, nvs_type_t type, T* out) {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        const Entry* entry;
+        esp_err_t err = getItem(handle, key, type, &entry);
+        if (err != ESP_OK) return err;
+        if (entry->data.size() != sizeof(T)) return ESP_ERR_NVS_TYPE_MISMATCH;
+        memcpy(out, entry->data.data(), sizeof(T));
+        return ESP_OK;
+    }
+
+    esp_err_t getVariable(nvs_handle_t handle, const char* key, nvs_type_t type, void* out, size_t* length) {
+        std::lock_guard<std::recursive_mutex> guard(lock);
+        const Entry* entry;
+        esp_err_t err = getItem(handle, key, type, &entry);
+        if (err != ESP_OK) return err;
+        if (!out) {
+            *length = entry->data.size();
+            return ESP_OK;
+        }
+        if (*length < entry->data.size()) {
+            *length = entry->data.size();
+            return ESP_ERR_NVS_INVALID_LENGTH;
+        }
+        memcpy(out, entry->data.data(), entry->data.size());
+        *length = entry->data.size();
+        return ESP_OK;
+    }
+}
+
+struct nvs_opaque_iterator_t {
+    std::vector<nvs_entry_info_t> entries;
+    size_t pos;
+};
+
+void hostNvsReset(bool persist) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    store.clear();
+    persistent = persist;
+    loaded = !persist;
+    stats = {0, 0, 0};
+}
+
+HostNvsStats hostNvsStats() {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    return stats;
+}
+
+extern "C" {
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode, nvs_handle_t* out_handle) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    esp_err_t err = checkName(name);
+    if (err != ESP_OK) return err;
+    load();
+    if (open_mode == NVS_READONLY && store.find(name) == store.end()) return ESP_ERR_NVS_NOT_FOUND;
+    store[name];
+    *out_handle = nextHandle++;
+    handles[*out_handle] = {name, open_mode == NVS_READONLY};
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    handles.erase(handle);
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    if (!findHandle(handle)) return ESP_ERR_NVS_INVALID_HANDLE;
+    stats.commits++;
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    Handle* h = findHandle(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (h->readOnly) return ESP_ERR_NVS_READ_ONLY;
+    stats.writes++;
+    if (store[h->ns].erase(key) == 0) return ESP_ERR_NVS_NOT_FOUND;
+    save();
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    Handle* h = findHandle(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    if (h->readOnly) return ESP_ERR_NVS_READ_ONLY;
+    store[h->ns].clear();
+    save();
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t h, const char* k, uint8_t v) { return setItem(h, k, NVS_TYPE_U8, &v, sizeof(v)); }
+esp_err_t nvs_set_i8(nvs_handle_t h, const char* k, int8_t v) { return setItem(h, k, NVS_TYPE_I8, &v, sizeof(v)); }
+esp_err_t nvs_set_u16(nvs_handle_t h, const char* k, uint16_t v) { return setItem(h, k, NVS_TYPE_U16, &v, sizeof(v)); }
+esp_err_t nvs_set_i16(nvs_handle_t h, const char* k, int16_t v) { return setItem(h, k, NVS_TYPE_I16, &v, sizeof(v)); }
+esp_err_t nvs_set_u32(nvs_handle_t h, const char* k, uint32_t v) { return setItem(h, k, NVS_TYPE_U32, &v, sizeof(v)); }
+esp_err_t nvs_set_i32(nvs_handle_t h, const char* k, int32_t v) { return setItem(h, k, NVS_TYPE_I32, &v, sizeof(v)); }
+esp_err_t nvs_set_u64(nvs_handle_t h, const char* k, uint64_t v) { return setItem(h, k, NVS_TYPE_U64, &v, sizeof(v)); }
+esp_err_t nvs_set_i64(nvs_handle_t h, const char* k, int64_t v) { return setItem(h, k, NVS_TYPE_I64, &v, sizeof(v)); }
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char* key, const char* value) {
+    return setItem(handle, key, NVS_TYPE_STR, value, strlen(value) + 1);
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length) {
+    return setItem(handle, key, NVS_TYPE_BLOB, value, length);
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t h, const char* k, uint8_t* v) { return getNumber(h, k, NVS_TYPE_U8, v); }
+esp_err_t nvs_get_i8(nvs_handle_t h, const char* k, int8_t* v) { return getNumber(h, k, NVS_TYPE_I8, v); }
+esp_err_t nvs_get_u16(nvs_handle_t h, const char* k, uint16_t* v) { return getNumber(h, k, NVS_TYPE_U16, v); }
+esp_err_t nvs_get_i16(nvs_handle_t h, const char* k, int16_t* v) { return getNumber(h, k, NVS_TYPE_I16, v); }
+esp_err_t nvs_get_u32(nvs_handle_t h, const char* k, uint32_t* v) { return getNumber(h, k, NVS_TYPE_U32, v); }
+esp_err_t nvs_get_i32(nvs_handle_t h, const char* k, int32_t* v) { return getNumber(h, k, NVS_TYPE_I32, v); }
+esp_err_t nvs_get_u64(nvs_handle_t h, const char* k, uint64_t* v) { return getNumber(h, k, NVS_TYPE_U64, v); }
+esp_err_t nvs_get_i64(nvs_handle_t h, const char* k, int64_t* v) { return getNumber(h, k, NVS_TYPE_I64, v); }
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char* key, char* out_value, size_t* length) {
+    return getVariable(handle, key, NVS_TYPE_STR, out_value, length);
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out_value, size_t* length) {
+    return getVariable(handle, key, NVS_TYPE_BLOB, out_value, length);
+}
+
+esp_err_t nvs_find_key(nvs_handle_t handle, const char* key, nvs_type_t* out_type) {
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    Handle* h = findHandle(handle);
+    if (!h) return ESP_ERR_NVS_INVALID_HANDLE;
+    stats.reads++;
+    auto& ns = store[h->ns];
+    auto it = ns.find(key);
+    if (it == ns.end()) return ESP_ERR_NVS_NOT_FOUND;
+    if (out_type) *out_type = it->second.type;
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_find(const char* part_name, const char* namespace_name, nvs_type_t type, nvs_iterator_t* output_iterator) {
+    (void)part_name;
+    std::lock_guard<std::recursive_mutex> guard(lock);
+    load();
+    *output_iterator = nullptr;
+    nvs_opaque_iterator_t* it = new nvs_opaque_iterator_t();
+    it->pos = 0;
+    for (const auto& ns : store) {
+        if (namespace_name && ns.first != namespace_name) continue;
+        for (const auto& item : ns.second) {
+            if (type != NVS_TYPE_ANY && item.second.type != type) continue;
+            nvs_entry_info_t info;
+            memset(&info, 0, sizeof(info));
+            strncpy(info.namespace_name, ns.first.c_str(), sizeof(info.namespace_name) - 1);
+            strncpy(info.key, item.first.c_str(), sizeof(info.key) - 1);
+            info.type = item.second.type;
+            it->entries.push_back(info);
+        }
+    }
+    if (it->entries.empty()) {
+        delete it;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    *output_iterator = it;
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator) {
+    if (!iterator || !*iterator) return ESP_ERR_INVALID_ARG;
+    if (++(*iterator)->pos >= (*iterator)->entries.size()) {
+        delete *iterator;
+        *iterator = nullptr;
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator, nvs_entry_info_t* out_info) {
+    if (!iterator || !out_info) return ESP_ERR_INVALID_ARG;
+    *out_info = iterator->entries[iterator->pos];
+    return ESP_OK;
+}
+
+void nvs_release_iterator(nvs_iterator_t iterator) {
+    delete iterator;
+}
+
+}
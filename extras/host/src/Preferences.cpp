@@ -0,0 +1,118 @@
+#include <Preferences.h>
+
+#include <vector>
+
+bool Preferences::begin(const char* name, bool ro, const char* partitionLabel) {
+    (void)partitionLabel;
+    if (started) return false;
+    readOnly = ro;
+    if (nvs_open(name, readOnly ? NVS_READONLY : NVS_READWRITE, &handle) != ESP_OK) return false;
+    started = true;
+    return true;
+}
+
+void Preferences::end() {
+    if (!started) return;
+    nvs_close(handle);
+    started = false;
+}
+
+bool Preferences::clear() {
+    if (!started || readOnly) return false;
+    return nvs_erase_all(handle) == ESP_OK && nvs_commit(handle) == ESP_OK;
+}
+
+bool Preferences::remove(const char* key) {
+    if (!started || !key || readOnly) return false;
+    return nvs_erase_key(handle, key) == ESP_OK && nvs_commit(handle) == ESP_OK;
+}
+
+bool Preferences::isKey(const char* key) {
+    if (!started || !key) return false;
+    return nvs_find_key(handle, key, nullptr) == ESP_OK;
+}
+
+#define PUT_NUMBER(function, type, setter) \
+    size_t Preferences::function(const char* key, type value) { \
+        if (!started || !key || readOnly) return 0; \
+        if (setter(handle, key, value) != ESP_OK || nvs_commit(handle) != ESP_OK) return 0; \
+        return sizeof(value); \
+    }
+
+PUT_NUMBER(putChar, int8_t, nvs_set_i8)
+PUT_NUMBER(putUChar, uint8_t, nvs_set_u8)
+PUT_NUMBER(putShort, int16_t, nvs_set_i16)
+PUT_NUMBER(putUShort, uint16_t, nvs_set_u16)
+PUT_NUMBER(putInt, int32_t, nvs_set_i32)
+PUT_NUMBER(putUInt, uint32_t, nvs_set_u32)
+PUT_NUMBER(putLong64, int64_t, nvs_set_i64)
+PUT_NUMBER(putULong64, uint64_t, nvs_set_u64)
+
+#define GET_NUMBER(function, type, getter) \
+    type Preferences::function(const char* key, type defaultValue) { \
+        type value = defaultValue; \
+        if (started && key) getter(handle, key, &value); \
+        return value; \
+    }
+
+GET_NUMBER(getChar, int8_t, nvs_get_i8)
+GET_NUMBER(getUChar, uint8_t, nvs_get_u8)
+GET_NUMBER(getShort, int16_t, nvs_get_i16)
+GET_NUMBER(getUShort, uint16_t, nvs_get_u16)
+GET_NUMBER(getInt, int32_t, nvs_get_i32)
+GET_NUMBER(getUInt, uint32_t, nvs_get_u32)
+GET_NUMBER(getLong64, int64_t, nvs_get_i64)
+GET_NUMBER(getULong64, uint64_t, nvs_get_u64)
+
+size_t Preferences::putString(const char* key, const char* value) {
+    if (!started || !key || !value || readOnly) return 0;
+    if (nvs_set_str(handle, key, value) != ESP_OK || nvs_commit(handle) != ESP_OK) return 0;
+    return strlen(value);
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    if (!started || !key || !value || !length || readOnly) return 0;
+    if (nvs_set_blob(handle, key, value, length) != ESP_OK || nvs_commit(handle) != ESP_OK) return 0;
+    return length;
+}
+
+float Preferences::getFloat(const char* key, float defaultValue) {
+    float value = defaultValue;
+    if (getBytesLength(key) == sizeof(value)) getBytes(key, &value, sizeof(value));
+    return value;
+}
+
+double Preferences::getDouble(const char* key, double defaultValue) {
+    double value = defaultValue;
+    if (getBytesLength(key) == sizeof(value)) getBytes(key, &value, sizeof(value));
+    return value;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    size_t len = 0;
+    if (!started || !key || nvs_get_str(handle, key, nullptr, &len) != ESP_OK || len == 0) return defaultValue;
+    std::vector<char> buf(len);
+    if (nvs_get_str(handle, key, buf.data(), &len) != ESP_OK) return defaultValue;
+    return String(buf.data());
+}
+
+size_t Preferences::getString(const char* key, char* value, size_t maxLen) {
+    size_t len = 0;
+    if (!started || !key || !value || !maxLen) return 0;
+    if (nvs_get_str(handle, key, nullptr, &len) != ESP_OK || len > maxLen) return 0;
+    if (nvs_get_str(handle, key, value, &len) != ESP_OK) return 0;
+    return len;
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    size_t len = 0;
+    if (!started || !key || nvs_get_blob(handle, key, nullptr, &len) != ESP_OK) return 0;
+    return len;
+}
+
+size_t Preferences::getBytes(const char* key, void* buf, size_t maxLen) {
+    size_t len = getBytesLength(key);
+    if (!len || !buf || !maxLen || len > maxLen) return 0;
+    if (nvs_get_blob(handle, key, buf, &len) != ESP_OK) return 0;
+    return len;
+}
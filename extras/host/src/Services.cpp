@@ -0,0 +1,30 @@
+#include <ArduinoOTA.h>
+#include <ESPmDNS.h>
+
+ArduinoOTAClass ArduinoOTA;
+MDNSResponder MDNS;
+
+bool MDNSResponder::begin(const char* name) {
+    if (!name || !*name) return false;
+    hostName = name;
+    active = true;
+    return true;
+}
+
+void MDNSResponder::end() {
+    active = false;
+    services.clear();
+    txt.clear();
+}
+
+bool MDNSResponder::addService(const char* service, const char* proto, uint16_t port) {
+    if (!active) return false;
+    services.push_back(String(service) + "." + proto + ":" + String((unsigned int)port));
+    return true;
+}
+
+bool MDNSResponder::addServiceTxt(const char* service, const char* proto, const char* key, const char* value) {
+    if (!active) return false;
+    txt.push_back({String(service) + "." + proto, String(key), String(value)});
+    return true;
+}
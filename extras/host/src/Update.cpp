@@ -0,0 +1,108 @@
+#include <Update.h>
+#include <HostRuntime.h>
+
+#include <sys/stat.h>
+
+UpdateClass Update;
+
+namespace {
+    // Größe der OTA-Partition im Standard-Partitionsschema (min_spiffs hat 1,9 MB)
+    const size_t PARTITION_SIZE = 0x140000;
+    const uint8_t IMAGE_MAGIC = 0xE9;
+}
+
+bool UpdateClass::begin(size_t size, int command, int ledPin, uint8_t ledOn, const char* label) {
+    (void)command;
+    (void)ledPin;
+    (void)ledOn;
+    (void)label;
+    if (file) {
+        error = UPDATE_ERROR_BAD_ARGUMENT;
+        return false;
+    }
+    error = UPDATE_ERROR_OK;
+    finished = false;
+    written = 0;
+    if (size != UPDATE_SIZE_UNKNOWN && size > PARTITION_SIZE) {
+        error = UPDATE_ERROR_SPACE;
+        return false;
+    }
+    expected = size == UPDATE_SIZE_UNKNOWN ? PARTITION_SIZE : size;
+    ::mkdir(HostRuntime::dataDir().c_str(), 0755);
+    std::string path = HostRuntime::dataDir() + "/update.bin";
+    file = fopen(path.c_str(), "wb");
+    if (!file) {
+        error = UPDATE_ERROR_WRITE;
+        return false;
+    }
+    return true;
+}
+
+size_t UpdateClass::write(uint8_t* data, size_t len) {
+    if (!file || hasError()) return 0;
+    if (written == 0 && len > 0 && data[0] != IMAGE_MAGIC) {
+        error = UPDATE_ERROR_MAGIC_BYTE;
+        abort();
+        return 0;
+    }
+    if (written + len > expected) {
+        error = UPDATE_ERROR_SPACE;
+        abort();
+        return 0;
+    }
+    size_t n = fwrite(data, 1, len, file);
+    written += n;
+    if (n != len) {
+        error = UPDATE_ERROR_WRITE;
+        abort();
+    }
+    return n;
+}
+
+bool UpdateClass::end(bool evenIfRemaining) {
+    if (!file) return false;
+    if (hasError()) {
+        abort();
+        return false;
+    }
+    if (!evenIfRemaining && expected != PARTITION_SIZE && written < expected) {
+        error = UPDATE_ERROR_ABORT;
+        abort();
+        return false;
+    }
+    fclose(file);
+    file = nullptr;
+    finished = true;
+    return true;
+}
+
+void UpdateClass::abort() {
+    if (file) {
+        fclose(file);
+        file = nullptr;
+    }
+    if (error == UPDATE_ERROR_OK) error = UPDATE_ERROR_ABORT;
+}
+
+const char* UpdateClass::errorString() const {
+    switch (error) {
+        case UPDATE_ERROR_OK: return "No Error";
+        case UPDATE_ERROR_WRITE: return "Flash Write Failed";
+        case UPDATE_ERROR_ERASE: return "Flash Erase Failed";
+        case UPDATE_ERROR_READ: return "Flash Read Failed";
+        case UPDATE_ERROR_SPACE: return "Not Enough Space";
+        case UPDATE_ERROR_SIZE: return "Bad Size Given";
+        case UPDATE_ERROR_STREAM: return "Stream Read Timeout";
+        case UPDATE_ERROR_MD5: return "MD5 Check Failed";
+        case UPDATE_ERROR_MAGIC_BYTE: return "Wrong Magic Byte";
+        case UPDATE_ERROR_ACTIVATE: return "Could Not Activate The Firmware";
+        case UPDATE_ERROR_NO_PARTITION: return "Partition Could Not be Found";
+        case UPDATE_ERROR_BAD_ARGUMENT: return "Bad Argument";
+        case UPDATE_ERROR_ABORT: return "Aborted";
+        default: return "UNKNOWN";
+    }
+}
+
+void UpdateClass::printError(Print& out) const {
+    out.println(errorString());
+}
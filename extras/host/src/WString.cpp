@@ -0,0 +1,202 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <type_traits>
+#include <utility>
+
+char String::nullChar = 0;
+
+template <typename T>
+static std::string toBase(T value, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    if (base == 10) return std::to_string(value);
+    typedef typename std::make_unsigned<T>::type U;
+    U v = (U)value;
+    std::string out;
+    do {
+        unsigned digit = (unsigned)(v % base);
+        out.insert(out.begin(), (char)(digit < 10 ? '0' + digit : 'a' + digit - 10));
+        v /= base;
+    } while (v);
+    return out;
+}
+
+static std::string formatFloat(double value, unsigned int decimalPlaces) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+    return buf;
+}
+
+String::String(unsigned char value, unsigned char base) : s(toBase(value, base)) {}
+String::String(int value, unsigned char base) : s(toBase(value, base)) {}
+String::String(unsigned int value, unsigned char base) : s(toBase(value, base)) {}
+String::String(long value, unsigned char base) : s(toBase(value, base)) {}
+String::String(unsigned long value, unsigned char base) : s(toBase(value, base)) {}
+String::String(long long value, unsigned char base) : s(toBase(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : s(toBase(value, base)) {}
+String::String(float value, unsigned int decimalPlaces) : s(formatFloat(value, decimalPlaces)) {}
+String::String(double value, unsigned int decimalPlaces) : s(formatFloat(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String& other) const {
+    if (s.size() != other.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+    }
+    return true;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const {
+    if (offset > s.size() || prefix.s.size() > s.size() - offset) return false;
+    return s.compare(offset, prefix.s.size(), prefix.s) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+    if (suffix.s.size() > s.size()) return false;
+    return s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+char& String::operator[](unsigned int index) {
+    if (index >= s.size()) {
+        nullChar = 0;
+        return nullChar;
+    }
+    return s[index];
+}
+
+void String::getBytes(unsigned char* buf, unsigned int bufsize, unsigned int index) const {
+    if (!bufsize || !buf) return;
+    if (index >= s.size()) {
+        buf[0] = 0;
+        return;
+    }
+    size_t n = s.size() - index;
+    if (n > bufsize - 1) n = bufsize - 1;
+    s.copy((char*)buf, n, index);
+    buf[n] = 0;
+}
+
+int String::indexOf(char c, unsigned int fromIndex) const {
+    size_t p = s.find(c, fromIndex);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::indexOf(const String& str, unsigned int fromIndex) const {
+    if (fromIndex > s.size()) return -1;
+    size_t p = s.find(str.s, fromIndex);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::lastIndexOf(char c) const {
+    size_t p = s.rfind(c);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::lastIndexOf(char c, unsigned int fromIndex) const {
+    size_t p = s.rfind(c, fromIndex);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::lastIndexOf(const String& str) const {
+    size_t p = s.rfind(str.s);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+int String::lastIndexOf(const String& str, unsigned int fromIndex) const {
+    size_t p = s.rfind(str.s, fromIndex);
+    return p == std::string::npos ? -1 : (int)p;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+    if (beginIndex > endIndex) {
+        unsigned int t = beginIndex;
+        beginIndex = endIndex;
+        endIndex = t;
+    }
+    if (beginIndex >= s.size()) return String();
+    if (endIndex > s.size()) endIndex = (unsigned int)s.size();
+    return String(s.substr(beginIndex, endIndex - beginIndex));
+}
+
+void String::replace(char find, char replacement) {
+    for (auto& c : s) {
+        if (c == find) c = replacement;
+    }
+}
+
+void String::replace(const String& find, const String& replacement) {
+    if (find.s.empty()) return;
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), replacement.s);
+        pos += replacement.s.size();
+    }
+}
+
+void String::toLowerCase() {
+    for (auto& c : s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (auto& c : s) c = (char)toupper((unsigned char)c);
+}
+
+void String::trim() {
+    size_t first = 0;
+    while (first < s.size() && isspace((unsigned char)s[first])) first++;
+    size_t last = s.size();
+    while (last > first && isspace((unsigned char)s[last - 1])) last--;
+    s = s.substr(first, last - first);
+}
+
+long String::toInt() const {
+    return atol(s.c_str());
+}
+
+float String::toFloat() const {
+    return (float)atof(s.c_str());
+}
+
+double String::toDouble() const {
+    return atof(s.c_str());
+}
+
+String operator+(const String& lhs, const String& rhs) {
+    String out(lhs);
+    out.concat(rhs);
+    return out;
+}
+
+String operator+(const String& lhs, const char* rhs) {
+    String out(lhs);
+    out.concat(rhs);
+    return out;
+}
+
+String operator+(const char* lhs, const String& rhs) {
+    String out(lhs);
+    out.concat(rhs);
+    return out;
+}
+
+String operator+(String&& lhs, const String& rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+String operator+(String&& lhs, const char* rhs) {
+    lhs.concat(rhs);
+    return std::move(lhs);
+}
+
+String operator+(const String& lhs, char rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned char rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned int rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, long long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, unsigned long long rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, float rhs) { return lhs + String(rhs); }
+String operator+(const String& lhs, double rhs) { return lhs + String(rhs); }
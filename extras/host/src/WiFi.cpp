@@ -0,0 +1,331 @@
+#include <WiFi.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <netdb.h>
+#include <arpa/inet.h>
+
+WiFiClass WiFi;
+
+namespace {
+    struct Network {
+        const char* ssid;
+        int32_t rssi;
+        wifi_auth_mode_t auth;
+    };
+    const Network NETWORKS[] = {
+        {"HostNet", -48, WIFI_AUTH_WPA2_PSK},
+        {"Nachbar-WLAN", -71, WIFI_AUTH_WPA2_PSK},
+        {"Gast", -80, WIFI_AUTH_OPEN},
+        {"FRITZ!Box 7590 XY", -84, WIFI_AUTH_WPA_WPA2_PSK},
+    };
+    const size_t FIXED_NETWORKS = sizeof(NETWORKS) / sizeof(NETWORKS[0]);
+    const char* const EXTRA_PREFIXES[] = {"FRITZ!Box 7530 ", "Vodafone-", "o2-WLAN", "TP-Link_", "MagentaWLAN-"};
+    const unsigned long CONNECT_DELAY_MS = 300;
+    const unsigned long RETRY_INTERVAL_MS = 3000;
+    const uint8_t REASON_ASSOC_LEAVE = 8;
+    const uint8_t REASON_BEACON_TIMEOUT = 200;
+    const uint8_t REASON_NO_AP_FOUND = 201;
+
+    struct Listener {
+        wifi_event_id_t id;
+        arduino_event_id_t event;
+        WiFiEventFuncCb callback;
+    };
+
+    struct Job {
+        std::chrono::steady_clock::time_point due;
+        std::function<void()> run;
+    };
+
+    // Zustand der simulierten Schnittstelle; alle Felder unter 'lock'
+    std::mutex lock;
+    wifi_mode_t currentMode = WIFI_OFF;
+    wl_status_t currentStatus = WL_IDLE_STATUS;
+    String currentSsid;
+    String hostname = "esp32-c3d4e5";
+    bool linkUp = true;
+    bool autoReconnect = true;
+    uint8_t extraNetworks = 0;
+    unsigned generation = 0;     // macht geplante Verbindungsversuche nach begin()/disconnect() ungültig
+    wifi_event_id_t nextListenerId = 1;
+    std::vector<Listener> listeners;
+
+    // Ereignis-Task: arbeitet zeitlich geplante Jobs ab, wie der "arduino_events"-Task
+    std::mutex jobLock;
+    std::condition_variable jobSignal;
+    std::vector<Job> jobs;
+    bool eventTaskStarted = false;
+
+    void eventTask() {
+        std::unique_lock<std::mutex> guard(jobLock);
+        for (;;) {
+            if (jobs.empty()) {
+                jobSignal.wait(guard);
+                continue;
+            }
+            auto next = jobs.begin();
+            for (auto it = jobs.begin(); it != jobs.end(); ++it) {
+                if (it->due < next->due) next = it;
+            }
+            if (next->due > std::chrono::steady_clock::now()) {
+                jobSignal.wait_until(guard, next->due);
+                continue;
+            }
+            auto run = next->run;
+            jobs.erase(next);
+            guard.unlock();
+            run();
+            guard.lock();
+        }
+    }
+
+    void schedule(unsigned long delayMs, std::function<void()> run) {
+        std::lock_guard<std::mutex> guard(jobLock);
+        if (!eventTaskStarted) {
+            std::thread(eventTask).detach();
+            eventTaskStarted = true;
+        }
+        jobs.push_back({std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs), run});
+        jobSignal.notify_one();
+    }
+
+    void emit(arduino_event_id_t event, const arduino_event_info_t& info) {
+        std::vector<Listener> targets;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            for (const auto& l : listeners) {
+                if (l.event == ARDUINO_EVENT_MAX || l.event == event) targets.push_back(l);
+            }
+        }
+        for (const auto& l : targets) l.callback(event, info);
+    }
+
+    void emitDisconnected(uint8_t reason) {
+        arduino_event_info_t info;
+        memset(&info, 0, sizeof(info));
+        std::string ssid = currentSsid.c_str();
+        info.wifi_sta_disconnected.ssid_len = (uint8_t)std::min<size_t>(ssid.size(), 32);
+        memcpy(info.wifi_sta_disconnected.ssid, ssid.data(), info.wifi_sta_disconnected.ssid_len);
+        info.wifi_sta_disconnected.reason = reason;
+        schedule(0, [info]() { emit(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, info); });
+    }
+
+    // Verbindungsversuch; bei fehlendem AP wie der ESP32 mit Auto-Reconnect periodisch wiederholen
+    void connectAttempt(unsigned gen) {
+        bool connected = false;
+        bool retry = false;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (gen != generation || currentMode == WIFI_AP || currentMode == WIFI_OFF) return;
+            if (linkUp) {
+                currentStatus = WL_CONNECTED;
+                connected = true;
+            } else {
+                currentStatus = WL_NO_SSID_AVAIL;
+                retry = autoReconnect;
+                emitDisconnected(REASON_NO_AP_FOUND);
+            }
+        }
+        if (connected) {
+            arduino_event_info_t info;
+            memset(&info, 0, sizeof(info));
+            emit(ARDUINO_EVENT_WIFI_STA_CONNECTED, info);
+            info.got_ip.ip_info.ip.addr = htonl(INADDR_LOOPBACK);
+            info.got_ip.ip_info.netmask.addr = htonl(0xFF000000);
+            info.got_ip.ip_changed = true;
+            emit(ARDUINO_EVENT_WIFI_STA_GOT_IP, info);
+        } else if (retry) {
+            schedule(RETRY_INTERVAL_MS, [gen]() { connectAttempt(gen); });
+        }
+    }
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (mode == currentMode) return true;
+    if ((mode == WIFI_AP || mode == WIFI_OFF) && currentStatus == WL_CONNECTED) {
+        emitDisconnected(REASON_ASSOC_LEAVE);
+    }
+    if (mode == WIFI_AP || mode == WIFI_OFF) {
+        currentStatus = WL_IDLE_STATUS;
+        generation++;
+    }
+    currentMode = mode;
+    return true;
+}
+
+wifi_mode_t WiFiClass::getMode() {
+    std::lock_guard<std::mutex> guard(lock);
+    return currentMode;
+}
+
+wl_status_t WiFiClass::status() {
+    std::lock_guard<std::mutex> guard(lock);
+    return currentStatus;
+}
+
+wl_status_t WiFiClass::begin(const char* ssid, const char* passphrase) {
+    (void)passphrase;
+    unsigned gen;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        if (currentMode == WIFI_OFF || currentMode == WIFI_AP) currentMode = WIFI_STA;
+        currentSsid = ssid ? ssid : "";
+        currentStatus = WL_DISCONNECTED;
+        gen = ++generation;
+    }
+    schedule(CONNECT_DELAY_MS, [gen]() { connectAttempt(gen); });
+    return WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifioff, bool eraseap) {
+    (void)eraseap;
+    std::lock_guard<std::mutex> guard(lock);
+    if (currentStatus == WL_CONNECTED) emitDisconnected(REASON_ASSOC_LEAVE);
+    currentStatus = WL_DISCONNECTED;
+    generation++;
+    if (wifioff) currentMode = WIFI_OFF;
+    return true;
+}
+
+bool WiFiClass::config(IPAddress, IPAddress, IPAddress, IPAddress) {
+    return true;
+}
+
+bool WiFiClass::setHostname(const char* name) {
+    std::lock_guard<std::mutex> guard(lock);
+    hostname = name ? name : "";
+    return true;
+}
+
+const char* WiFiClass::getHostname() {
+    std::lock_guard<std::mutex> guard(lock);
+    return hostname.c_str();
+}
+
+bool WiFiClass::setAutoReconnect(bool enabled) {
+    std::lock_guard<std::mutex> guard(lock);
+    autoReconnect = enabled;
+    return true;
+}
+
+bool WiFiClass::softAP(const char* ssid, const char* passphrase) {
+    (void)ssid;
+    (void)passphrase;
+    std::lock_guard<std::mutex> guard(lock);
+    if (currentMode == WIFI_STA) currentMode = WIFI_AP_STA;
+    else if (currentMode == WIFI_OFF) currentMode = WIFI_AP;
+    return true;
+}
+
+IPAddress WiFiClass::softAPIP() {
+    return IPAddress(192, 168, 4, 1);
+}
+
+IPAddress WiFiClass::localIP() {
+    return status() == WL_CONNECTED ? IPAddress(127, 0, 0, 1) : IPAddress();
+}
+
+String WiFiClass::SSID() {
+    std::lock_guard<std::mutex> guard(lock);
+    return currentStatus == WL_CONNECTED ? currentSsid : String();
+}
+
+int8_t WiFiClass::RSSI() {
+    return status() == WL_CONNECTED ? -52 : 0;
+}
+
+String WiFiClass::macAddress() {
+    return "A1:B2:C3:D4:E5:F6";
+}
+
+int16_t WiFiClass::scanNetworks(bool async) {
+    (void)async;
+    // Ein echter Scan blockiert ca. 2 s; auf dem Host reicht eine kurze Pause
+    delay(50);
+    std::lock_guard<std::mutex> guard(lock);
+    size_t count = FIXED_NETWORKS + extraNetworks;
+    return count > 255 ? 255 : (int16_t)count;
+}
+
+String WiFiClass::SSID(uint8_t index) {
+    if (index < FIXED_NETWORKS) return String(NETWORKS[index].ssid);
+    std::lock_guard<std::mutex> guard(lock);
+    if (index >= FIXED_NETWORKS + extraNetworks) return String();
+    // Reproduzierbare Namen in der Art echter Nachbarnetze
+    char name[33];
+    snprintf(name, sizeof(name), "%s%04X", EXTRA_PREFIXES[index % 5], (unsigned)((index * 2654435761u) >> 16));
+    return String(name);
+}
+
+int32_t WiFiClass::RSSI(uint8_t index) {
+    if (index < FIXED_NETWORKS) return NETWORKS[index].rssi;
+    std::lock_guard<std::mutex> guard(lock);
+    return index < FIXED_NETWORKS + extraNetworks ? -60 - index % 35 : 0;
+}
+
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t index) {
+    if (index < FIXED_NETWORKS) return NETWORKS[index].auth;
+    std::lock_guard<std::mutex> guard(lock);
+    return index < FIXED_NETWORKS + extraNetworks ? WIFI_AUTH_WPA2_PSK : WIFI_AUTH_OPEN;
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& result) {
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    struct addrinfo* found = nullptr;
+    if (getaddrinfo(host, nullptr, &hints, &found) != 0 || !found) return 0;
+    result = (uint32_t)((struct sockaddr_in*)found->ai_addr)->sin_addr.s_addr;
+    freeaddrinfo(found);
+    return 1;
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventCb callback, arduino_event_id_t event) {
+    return onEvent([callback](arduino_event_id_t e, arduino_event_info_t) { callback(e); }, event);
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventFuncCb callback, arduino_event_id_t event) {
+    std::lock_guard<std::mutex> guard(lock);
+    listeners.push_back({nextListenerId, event, callback});
+    return nextListenerId++;
+}
+
+void WiFiClass::removeEvent(wifi_event_id_t id) {
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto it = listeners.begin(); it != listeners.end(); ++it) {
+        if (it->id == id) {
+            listeners.erase(it);
+            return;
+        }
+    }
+}
+
+void WiFiClass::hostSetLinkUp(bool up) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (up == linkUp) return;
+    linkUp = up;
+    if (!up && currentStatus == WL_CONNECTED) {
+        currentStatus = WL_CONNECTION_LOST;
+        emitDisconnected(REASON_BEACON_TIMEOUT);
+        if (autoReconnect) {
+            unsigned gen = generation;
+            schedule(RETRY_INTERVAL_MS, [gen]() { connectAttempt(gen); });
+        }
+    }
+}
+
+bool WiFiClass::hostLinkUp() {
+    std::lock_guard<std::mutex> guard(lock);
+    return linkUp;
+}
+
+void WiFiClass::hostSetExtraNetworks(uint8_t count) {
+    std::lock_guard<std::mutex> guard(lock);
+    extraNetworks = count;
+}
@@ -0,0 +1,59 @@
+// Einstiegspunkt des Host-Builds: setup() einmal, dann loop() endlos - wie der Arduino-Core.
+//
+//   ./wwm-host [--port 8080] [--data host-data]
+//
+// SIGUSR1 schaltet den simulierten Access Point aus bzw. wieder ein (Verbindungsabbruch testen).
+
+#include <Arduino.h>
+#include <HostRuntime.h>
+#include <WiFi.h>
+
+#include <atomic>
+#include <malloc.h>
+#include <signal.h>
+
+void setup();
+void loop();
+
+static std::atomic<bool> toggleLink(false);
+
+static void onSignal(int) {
+    toggleLink = true;
+}
+
+static void usage(const char* name) {
+    fprintf(stderr, "Aufruf: %s [--port N] [--data VERZEICHNIS]\n", name);
+    exit(2);
+}
+
+int main(int argc, char** argv) {
+    // Ein Arena für alle Threads: ESP.getFreeHeap() folgt dann dem tatsächlichen Verbrauch
+    mallopt(M_ARENA_MAX, 1);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    HostRuntime::setCommandLine(argc, argv);
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--port") && i + 1 < argc) {
+            HostRuntime::setHttpPort((uint16_t)atoi(argv[++i]));
+        } else if (!strcmp(argv[i], "--data") && i + 1 < argc) {
+            HostRuntime::setDataDir(argv[++i]);
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGUSR1, onSignal);
+
+    setup();
+    for (;;) {
+        if (toggleLink.exchange(false)) {
+            bool up = !WiFi.hostLinkUp();
+            Serial.printf("[host] Access Point %s\n", up ? "wieder erreichbar" : "abgeschaltet");
+            WiFi.hostSetLinkUp(up);
+        }
+        loop();
+        // Der Arduino-Core gibt zwischen zwei loop()-Durchläufen ebenfalls kurz ab
+        delay(1);
+    }
+}
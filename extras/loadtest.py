@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""WiFiWebManager - Lastgenerator
+
+Spielt gemischte Last gegen das Web-Interface eines Geraets ab und meldet
+Durchsatz, Latenz-Perzentile pro Route und den Speicherverlauf des Geraets
+(ueber /api/status) als JSON oder CSV.
+
+Beispiele:
+
+    python3 extras/loadtest.py 192.168.1.50
+    python3 extras/loadtest.py 192.168.1.50 --clients 8 --duration 60 --format csv
+    python3 extras/loadtest.py 192.168.1.50 --post /sensor wert=42
+    python3 extras/loadtest.py 192.168.1.50 --ota firmware.bin   # ACHTUNG: flasht und startet neu!
+
+Standard-Mix: Home-Polling (Seite + Fragment), /wlan-Aufrufe (inkl. WLAN-Scan)
+und /ntp. Form-POSTs und OTA-Uploads veraendern das Geraet und laufen deshalb
+nur, wenn sie explizit angegeben werden.
+"""
+
+import argparse
+import csv
+import http.client
+import json
+import random
+import sys
+import threading
+import time
+import uuid
+from urllib.parse import urlencode
+
+# (Name, Gewicht, Methode, Pfad)
+DEFAULT_MIX = [
+    ("home", 40, "GET", "/"),
+    ("home_fragment", 40, "GET", "/wwm/fragment?page=/&name=status"),
+    ("wlan", 10, "GET", "/wlan"),
+    ("ntp", 10, "GET", "/ntp"),
+]
+
+CSV_FIELDS = ["route", "requests", "errors", "rps", "avg_bytes", "p50_ms", "p90_ms", "p99_ms", "max_ms"]
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = {}
+        self.errors = {}
+        self.bytes = {}
+
+    def record(self, route, seconds, size, ok):
+        with self.lock:
+            self.latencies.setdefault(route, []).append(seconds)
+            self.bytes[route] = self.bytes.get(route, 0) + size
+            if not ok:
+                self.errors[route] = self.errors.get(route, 0) + 1
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    k = min(len(values) - 1, max(0, int(round(p / 100.0 * (len(values) - 1)))))
+    return values[k]
+
+
+def request(host, port, method, path, body=None, headers=None, timeout=10):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        conn.request(method, path, body=body, headers=headers or {})
+        resp = conn.getresponse()
+        data = resp.read()
+        return resp.status, data
+    finally:
+        conn.close()
+
+
+def worker(args, mix, stats, stop_at):
+    weights = [m[1] for m in mix]
+    headers = {"Accept-Encoding": "gzip"} if args.gzip else {}
+    while time.time() < stop_at:
+        name, _, method, path, body, extra = random.choices(mix, weights)[0]
+        h = dict(headers)
+        h.update(extra)
+        start = time.perf_counter()
+        try:
+            status, data = request(args.host, args.port, method, path, body, h, args.timeout)
+            ok = status < 400
+            size = len(data)
+        except (OSError, http.client.HTTPException):
+            ok, size = False, 0
+        stats.record(name, time.perf_counter() - start, size, ok)
+        if args.think > 0:
+            time.sleep(args.think / 1000.0)
+
+
+def memory_sampler(args, samples, stop_event):
+    while not stop_event.is_set():
+        try:
+            status, data = request(args.host, args.port, "GET", "/api/status", timeout=args.timeout)
+            if status == 200:
+                info = json.loads(data)
+                samples.append((time.time(), info.get("heap_free", 0), info.get("heap_min", 0)))
+        except (OSError, ValueError, http.client.HTTPException):
+            pass
+        stop_event.wait(1.0)
+
+
+def run_ota(args):
+    with open(args.ota, "rb") as f:
+        firmware = f.read()
+    boundary = uuid.uuid4().hex
+    body = (("--%s\r\nContent-Disposition: form-data; name=\"update\"; filename=\"fw.bin\"\r\n"
+             "Content-Type: application/octet-stream\r\n\r\n") % boundary).encode() + firmware + \
+           ("\r\n--%s--\r\n" % boundary).encode()
+    headers = {"Content-Type": "multipart/form-data; boundary=%s" % boundary}
+    start = time.perf_counter()
+    status, _ = request(args.host, args.port, "POST", "/update", body, headers, timeout=300)
+    seconds = time.perf_counter() - start
+    return {"route": "ota", "status": status, "bytes": len(firmware), "seconds": round(seconds, 3),
+            "kib_per_s": round(len(firmware) / 1024.0 / seconds, 1) if seconds > 0 else 0}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Lasttest fuer das WiFiWebManager Web-Interface")
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4, help="parallele Clients")
+    parser.add_argument("--duration", type=float, default=30, help="Laufzeit in Sekunden")
+    parser.add_argument("--think", type=float, default=0, help="Pause je Client zwischen Requests (ms)")
+    parser.add_argument("--timeout", type=float, default=10)
+    parser.add_argument("--no-gzip", dest="gzip", action="store_false", help="kein Accept-Encoding: gzip")
+    parser.add_argument("--post", nargs="+", metavar=("PFAD", "FELD=WERT"),
+                        help="Form-POST in den Mix aufnehmen (veraendert ggf. Einstellungen!)")
+    parser.add_argument("--ota", metavar="FIRMWARE.BIN",
+                        help="nach dem Lasttest ein OTA-Upload messen (Geraet startet neu!)")
+    parser.add_argument("--format", choices=["json", "csv"], default="json")
+    parser.add_argument("--output", help="Datei statt stdout")
+    args = parser.parse_args()
+
+    mix = [(n, w, m, p, None, {}) for n, w, m, p in DEFAULT_MIX]
+    if args.post:
+        fields = dict(kv.split("=", 1) for kv in args.post[1:])
+        mix.append(("post " + args.post[0], 10, "POST", args.post[0], urlencode(fields),
+                    {"Content-Type": "application/x-www-form-urlencoded"}))
+
+    stats = Stats()
+    samples = []
+    stop_event = threading.Event()
+    sampler = threading.Thread(target=memory_sampler, args=(args, samples, stop_event), daemon=True)
+    sampler.start()
+
+    started = time.time()
+    stop_at = started + args.duration
+    threads = [threading.Thread(target=worker, args=(args, mix, stats, stop_at)) for _ in range(args.clients)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    elapsed = time.time() - started
+    stop_event.set()
+    sampler.join()
+
+    rows = []
+    total = 0
+    for route, lat in sorted(stats.latencies.items()):
+        total += len(lat)
+        rows.append({
+            "route": route,
+            "requests": len(lat),
+            "errors": stats.errors.get(route, 0),
+            "rps": round(len(lat) / elapsed, 2),
+            "avg_bytes": int(stats.bytes.get(route, 0) / len(lat)),
+            "p50_ms": round(percentile(lat, 50) * 1000, 1),
+            "p90_ms": round(percentile(lat, 90) * 1000, 1),
+            "p99_ms": round(percentile(lat, 99) * 1000, 1),
+            "max_ms": round(max(lat) * 1000, 1),
+        })
+
+    summary = {
+        "host": args.host,
+        "clients": args.clients,
+        "duration_s": round(elapsed, 1),
+        "requests": total,
+        "rps": round(total / elapsed, 2) if elapsed > 0 else 0,
+        "heap_free_min": min((s[1] for s in samples), default=None),
+        "heap_min_device": min((s[2] for s in samples), default=None),
+        "routes": rows,
+    }
+    if args.ota:
+        summary["ota"] = run_ota(args)
+
+    out = open(args.output, "w", newline="") if args.output else sys.stdout
+    try:
+        if args.format == "json":
+            json.dump(summary, out, indent=2)
+            out.write("\n")
+        else:
+            writer = csv.DictWriter(out, fieldnames=CSV_FIELDS)
+            writer.writeheader()
+            writer.writerows(rows)
+            writer.writerow({"route": "TOTAL", "requests": total, "rps": summary["rps"]})
+            out.write("# heap_free_min=%s heap_min_device=%s\n" %
+                      (summary["heap_free_min"], summary["heap_min_device"]))
+    finally:
+        if out is not sys.stdout:
+            out.close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""WiFiWebManager - mDNS-Stand-in zum Testen von discover.py
+
+Beantwortet DNS-SD-Anfragen nach _wifiwebmanager._tcp so, wie es die Geraete tun
+(PTR in der Antwort, SRV/TXT/A als Zusatzrecords, Namenskompression), ohne dass
+echte Geraete oder Multicast im Netz noetig sind. Antworten gehen wie bei
+"legacy unicast" (RFC 6762 6.7) direkt an den Absender der Anfrage.
+
+Beispiele:
+
+    python3 extras/mdns_standin.py --port 5354 &
+    python3 extras/discover.py --mdns 127.0.0.1:5354 --timeout 1.5
+
+    # Host-Build (extras/host) als Geraet eintragen, dann funktioniert auch --status:
+    python3 extras/mdns_standin.py --port 5354 --device wwm-host=127.0.0.1:8080 &
+    python3 extras/discover.py --mdns 127.0.0.1:5354 --timeout 1.5 --status
+
+    # Paketverlust und auf mehrere Pakete verteilte Antworten nachstellen
+    python3 extras/mdns_standin.py --port 5354 --devices 20 --per-packet 4 --drop-first
+"""
+
+import argparse
+import socket
+import struct
+import sys
+
+SERVICE = "_wifiwebmanager._tcp.local"
+MDNS_GROUP = "224.0.0.251"
+
+TYPE_A, TYPE_PTR, TYPE_TXT, TYPE_SRV, TYPE_ANY = 1, 12, 16, 33, 255
+CLASS_IN, CACHE_FLUSH = 1, 0x8000
+
+
+class Packet:
+    """Antwortpaket mit einfacher Namenskompression (bekannte Suffixe per Zeiger)."""
+
+    def __init__(self, qid):
+        self.data = bytearray(struct.pack("!HHHHHH", qid, 0x8400, 0, 0, 0, 0))
+        self.names = {}
+        self.answers = 0
+        self.additional = 0
+
+    def name(self, name):
+        labels = name.rstrip(".").split(".")
+        for i in range(len(labels)):
+            suffix = ".".join(labels[i:]).lower()
+            if suffix in self.names:
+                self.data += struct.pack("!H", 0xC000 | self.names[suffix])
+                return
+            if len(self.data) < 0x3FFF:
+                self.names[suffix] = len(self.data)
+            raw = labels[i].encode()
+            self.data += bytes([len(raw)]) + raw
+        self.data += b"\x00"
+
+    def record(self, name, rtype, write_rdata, ttl=120, unique=True, answer=False):
+        self.name(name)
+        rclass = CLASS_IN | (CACHE_FLUSH if unique else 0)
+        self.data += struct.pack("!HHI", rtype, rclass, ttl)
+        length_pos = len(self.data)
+        self.data += b"\x00\x00"
+        write_rdata()
+        struct.pack_into("!H", self.data, length_pos, len(self.data) - length_pos - 2)
+        if answer:
+            self.answers += 1
+        else:
+            self.additional += 1
+
+    def finish(self):
+        struct.pack_into("!HH", self.data, 6, self.answers, 0)
+        struct.pack_into("!H", self.data, 10, self.additional)
+        return bytes(self.data)
+
+
+def add_device(packet, device):
+    instance = "%s.%s" % (device["instance"], SERVICE)
+    host = device["host"] + ".local"
+    packet.record(SERVICE, TYPE_PTR, lambda: packet.name(instance), ttl=4500, unique=False, answer=True)
+
+    def srv():
+        packet.data += struct.pack("!HHH", 0, 0, device["port"])
+        packet.name(host)
+
+    def txt():
+        for key, value in device["txt"].items():
+            entry = ("%s=%s" % (key, value)).encode()[:255]
+            packet.data += bytes([len(entry)]) + entry
+
+    packet.record(instance, TYPE_SRV, srv)
+    packet.record(instance, TYPE_TXT, txt, ttl=4500)
+    packet.record(host, TYPE_A, lambda: packet.data.extend(socket.inet_aton(device["ip"])))
+
+
+def parse_questions(data):
+    """Liefert (ID, [(Name, Typ)]) - Namen ohne Kompression, wie sie Clients senden."""
+    qid, flags, qdcount = struct.unpack("!HHH", data[:6])
+    if flags & 0x8000:
+        return qid, []      # selbst eine Antwort
+    pos, questions = 12, []
+    for _ in range(qdcount):
+        labels = []
+        while data[pos] != 0:
+            if data[pos] & 0xC0:
+                raise ValueError("Kompression in der Frage")
+            labels.append(data[pos + 1:pos + 1 + data[pos]].decode("utf-8", "replace"))
+            pos += 1 + data[pos]
+        qtype, _ = struct.unpack("!HH", data[pos + 1:pos + 5])
+        pos += 5
+        questions.append((".".join(labels).lower(), qtype))
+    return qid, questions
+
+
+def make_devices(args):
+    devices = []
+    for spec in args.device:
+        name, _, target = spec.partition("=")
+        ip, _, port = target.partition(":")
+        if not name or not ip:
+            sys.exit("--device erwartet NAME=IP[:PORT], nicht %r" % spec)
+        devices.append({"instance": name, "host": name, "ip": ip, "port": int(port or 80)})
+    if not args.device:
+        base = struct.unpack("!I", socket.inet_aton(args.base_ip))[0]
+        for i in range(args.devices):
+            name = "sensor-%02d" % i
+            ip = socket.inet_ntoa(struct.pack("!I", base + i))
+            devices.append({"instance": name, "host": name, "ip": ip, "port": 80})
+    for device in devices:
+        # Dieselben TXT-Records wie WiFiWebManager::startMDNS()
+        device["txt"] = {
+            "version": args.version,
+            "fw": "1.0.0 Oct 18 2026 10:00:00",
+            "metrics": "/api/status",
+            "config": "/config/export",
+        }
+    return devices
+
+
+def main():
+    parser = argparse.ArgumentParser(description="mDNS-Stand-in fuer Tests von discover.py")
+    parser.add_argument("--bind", default="127.0.0.1", help="lokale Adresse (Standard: 127.0.0.1)")
+    parser.add_argument("--port", type=int, default=5354, help="UDP-Port (5353 + --multicast fuer echtes mDNS)")
+    parser.add_argument("--multicast", action="store_true", help="der Gruppe 224.0.0.251 beitreten")
+    parser.add_argument("--devices", type=int, default=3, help="Anzahl simulierter Geraete")
+    parser.add_argument("--base-ip", default="10.0.0.10", help="IP des ersten simulierten Geraets")
+    parser.add_argument("--device", action="append", default=[], metavar="NAME=IP[:PORT]",
+                        help="Geraet mit fester Adresse (mehrfach moeglich, ersetzt --devices)")
+    parser.add_argument("--version", default="2.0.1", help="TXT-Record version")
+    parser.add_argument("--per-packet", type=int, default=0, metavar="N",
+                        help="hoechstens N Geraete pro Antwortpaket (Standard: alle in einem)")
+    parser.add_argument("--drop-first", action="store_true",
+                        help="erste Anfrage jedes Absenders ignorieren (Paketverlust)")
+    parser.add_argument("--count", type=int, default=0, help="nach N beantworteten Anfragen beenden")
+    args = parser.parse_args()
+
+    devices = make_devices(args)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("0.0.0.0" if args.multicast else args.bind, args.port))
+    if args.multicast:
+        membership = socket.inet_aton(MDNS_GROUP) + socket.inet_aton("0.0.0.0")
+        sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, membership)
+    print("mDNS-Stand-in auf %s:%d mit %d Geraet(en)" % (args.bind, args.port, len(devices)), file=sys.stderr)
+
+    seen, answered = set(), 0
+    per_packet = args.per_packet if args.per_packet > 0 else max(len(devices), 1)
+    while True:
+        data, source = sock.recvfrom(9000)
+        try:
+            qid, questions = parse_questions(data)
+        except (IndexError, ValueError, struct.error):
+            continue
+        if not any(name == SERVICE and qtype in (TYPE_PTR, TYPE_ANY) for name, qtype in questions):
+            continue
+        if args.drop_first and source not in seen:
+            seen.add(source)
+            continue
+        for start in range(0, len(devices), per_packet):
+            packet = Packet(qid)
+            for device in devices[start:start + per_packet]:
+                add_device(packet, device)
+            sock.sendto(packet.finish(), source)
+        answered += 1
+        if args.count and answered >= args.count:
+            return 0
+
+
+if __name__ == "__main__":
+    try:
+        sys.exit(main())
+    except KeyboardInterrupt:
+        sys.exit(0)
@@ -0,0 +1,58 @@
+#pragma once
+
+// Gemeinsame Helfer der Host-Tests: CHECK-Makros, Zeitmessung und Aufruf mit --bench
+
+#include <Arduino.h>
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+
+namespace TestSupport {
+    inline int& failures() {
+        static int count = 0;
+        return count;
+    }
+
+    inline bool benchRequested(int argc, char** argv) {
+        for (int i = 1; i < argc; i++) {
+            if (!strcmp(argv[i], "--bench")) return true;
+        }
+        return false;
+    }
+
+    // Mittlere Laufzeit von fn() in Mikrosekunden über n Aufrufe
+    template <typename Fn>
+    double measureUs(unsigned n, Fn fn) {
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < n; i++) fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::micro>(end - start).count() / n;
+    }
+
+    inline int finish(const char* name) {
+        if (failures()) {
+            printf("%s: %d Fehler\n", name, failures());
+            return 1;
+        }
+        printf("%s: ok\n", name);
+        return 0;
+    }
+}
+
+#define CHECK(cond)                                                               \
+    do {                                                                          \
+        if (!(cond)) {                                                            \
+            printf("%s:%d: CHECK fehlgeschlagen: %s\n", __FILE__, __LINE__, #cond); \
+            TestSupport::failures()++;                                            \
+        }                                                                         \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                \
+    do {                                                                          \
+        auto a_ = (actual);                                                       \
+        auto e_ = (expected);                                                     \
+        if (!(a_ == e_)) {                                                        \
+            printf("%s:%d: CHECK_EQ fehlgeschlagen: %s\n", __FILE__, __LINE__, #actual " == " #expected); \
+            TestSupport::failures()++;                                            \
+        }                                                                         \
+    } while (0)
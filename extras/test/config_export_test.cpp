@@ -0,0 +1,267 @@
+// Konfigurations-Export/-Import (exportConfig()/importConfig()): Roundtrip inklusive Custom Data
+// und float-Bits, Passphrase und AES-GCM (falscher Schlüssel, Manipulation, Wert in anderem Feld),
+// Validierung ohne Teilschreiben und Zahl der NVS-Commits bzw. Neustarts.
+// Mit --bench: Dauer von Export und Import mit und ohne Passphrase.
+
+#include <WiFiWebManager.h>
+#include <WiFiWebManagerSecret.h>
+#include <nvs.h>
+
+#include <vector>
+
+#include "TestSupport.h"
+
+static const char* const PASSPHRASE = "korrekt pferd batterie heftklammer";
+
+static std::vector<String> lines(const String& text) {
+    std::vector<String> out;
+    unsigned int pos = 0;
+    while (pos < text.length()) {
+        int end = text.indexOf('\n', pos);
+        if (end < 0) end = text.length();
+        out.push_back(text.substring(pos, end));
+        pos = end + 1;
+    }
+    return out;
+}
+
+static String join(const std::vector<String>& parts) {
+    String out;
+    for (const auto& line : parts) out += line + "\n";
+    return out;
+}
+
+// Index der Zeile, die mit prefix beginnt, sonst -1
+static int findLine(const std::vector<String>& parts, const String& prefix) {
+    for (size_t i = 0; i < parts.size(); i++) {
+        if (parts[i].startsWith(prefix)) return (int)i;
+    }
+    return -1;
+}
+
+static uint32_t floatBits(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+static const float FLOATS[] = {0.1f, -3.4028235e38f, 1.4e-45f, 16777217.0f};
+static const char* const FLOAT_KEYS[] = {"f_zehntel", "f_min", "f_denorm", "f_2hoch24"};
+
+class WiFiWebManagerTest {
+public:
+    static void fillSource(WiFiWebManager& m) {
+        hostNvsReset(false);
+        m.loadConfig();
+        m.ssid = "FRITZ!Box 7590 XY";
+        m.password = "geheim=mit%zeichen\nund zeile";
+        m.hostname = "esp32-wohnzimmer";
+        m.useStaticIP = true;
+        m.ip = "192.168.178.50";
+        m.gateway = "192.168.178.1";
+        m.subnet = "255.255.255.0";
+        m.dns = "192.168.178.1";
+        m.ntpEnable = true;
+        m.ntpServer = "fritz.box, pool.ntp.org";
+        m.saveConfig();
+
+        m.saveCustomData("name", String("Wohnzimmer"));
+        m.saveCustomData("interval", 5000);
+        m.saveCustomData("aktiv", true);
+        m.saveCustomData("token", String("api-1234"));
+        m.setCustomDataSecret("token");
+        for (size_t i = 0; i < sizeof(FLOATS) / sizeof(FLOATS[0]); i++) m.saveCustomData(FLOAT_KEYS[i], FLOATS[i]);
+    }
+
+    static bool sameNetwork(const WiFiWebManager& a, const WiFiWebManager& b) {
+        return a.ssid == b.ssid && a.password == b.password && a.hostname == b.hostname &&
+               a.useStaticIP == b.useStaticIP && a.ip == b.ip && a.gateway == b.gateway && a.subnet == b.subnet &&
+               a.dns == b.dns && a.ntpEnable == b.ntpEnable && a.ntpServer == b.ntpServer;
+    }
+
+    // Export -> leeres Gerät -> Import -> Export: gleicher Inhalt, float bitgenau
+    static void roundTrip() {
+        WiFiWebManager source;
+        fillSource(source);
+        String plain = source.exportConfig();
+        String sealed = source.exportConfig(PASSPHRASE);
+        CHECK(plain.indexOf("pwd") < 0);                     // Geheimnisse ohne Passphrase nicht exportiert
+        CHECK(plain.indexOf("api-1234") < 0);
+        CHECK(sealed.indexOf("geheim") < 0 && sealed.indexOf("api-1234") < 0);
+        CHECK(findLine(lines(sealed), "pwd!=") > 0 && findLine(lines(sealed), "c:s:token!=") > 0);
+
+        hostNvsReset(false);
+        WiFiWebManager target;
+        target.loadConfig();
+        String error;
+        CHECK(target.importConfig(sealed, PASSPHRASE, error));
+        CHECK(error.length() == 0);
+        CHECK(sameNetwork(source, target));
+        CHECK(target.loadCustomData("token") == "api-1234");
+        CHECK_EQ(target.loadCustomDataInt("interval"), 5000);
+        CHECK(target.loadCustomDataBool("aktiv"));
+        for (size_t i = 0; i < sizeof(FLOATS) / sizeof(FLOATS[0]); i++) {
+            CHECK_EQ(floatBits(target.loadCustomDataFloat(FLOAT_KEYS[i])), floatBits(FLOATS[i]));
+        }
+
+        // Ohne Passphrase identisch; mit Passphrase unterscheiden sich nur Salt, IVs und Chiffretexte
+        target.setCustomDataSecret("token");
+        CHECK(target.exportConfig() == plain);
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        CHECK(sameNetwork(source, reloaded));
+    }
+
+    static void passphraseRequired() {
+        WiFiWebManager source;
+        fillSource(source);
+        String sealed = source.exportConfig(PASSPHRASE);
+        WiFiWebManager target;
+        target.loadConfig();
+        String error;
+        CHECK(!target.importConfig(sealed, "falsch", error));
+        CHECK(error.indexOf("Entschlüsselung") >= 0);
+        CHECK(!target.importConfig(sealed, "", error));
+        CHECK(error.indexOf("Passphrase erforderlich") >= 0);
+
+        // Verschlüsselte Zeile ohne kdf-Zeile
+        std::vector<String> parts = lines(sealed);
+        parts.erase(parts.begin() + findLine(parts, "kdf="));
+        CHECK(!target.importConfig(join(parts), PASSPHRASE, error));
+        CHECK(error.indexOf("ohne kdf") >= 0);
+    }
+
+    static void tamperingDetected() {
+        WiFiWebManager source;
+        fillSource(source);
+        std::vector<String> parts = lines(source.exportConfig(PASSPHRASE));
+        int pwdLine = findLine(parts, "pwd!=");
+        int tokenLine = findLine(parts, "c:s:token!=");
+        String error;
+
+        // Ein Bit im Chiffretext
+        std::vector<String> flipped = parts;
+        String& value = flipped[pwdLine];
+        unsigned int at = value.length() - 40;
+        value.setCharAt(at, value[at] == '0' ? '1' : '0');
+        WiFiWebManager target;
+        target.loadConfig();
+        CHECK(!target.importConfig(join(flipped), PASSPHRASE, error));
+        CHECK(error.startsWith("Zeile " + String(pwdLine + 1) + ":"));
+
+        // Gültig versiegelter Wert in ein anderes Feld kopiert: AAD (Feldname) passt nicht
+        std::vector<String> swapped = parts;
+        swapped[tokenLine] = "c:s:token!=" + parts[pwdLine].substring(strlen("pwd!="));
+        CHECK(!target.importConfig(join(swapped), PASSPHRASE, error));
+        CHECK(error.startsWith("Zeile " + String(tokenLine + 1) + ":"));
+
+        // Gekürzt (Tag unvollständig)
+        std::vector<String> truncated = parts;
+        truncated[pwdLine] = parts[pwdLine].substring(0, parts[pwdLine].length() - 8);
+        HostNvsStats before = hostNvsStats();
+        CHECK(!target.importConfig(join(truncated), PASSPHRASE, error));
+        CHECK_EQ(hostNvsStats().commits, before.commits);
+    }
+
+    // Fehler in Zeile N: nichts geschrieben, auch nicht die gültigen Werte davor
+    static void invalidLineWritesNothing() {
+        WiFiWebManager m;
+        fillSource(m);
+        String before = m.exportConfig();
+        String text = "[wwm-config v1]\n"
+                      "ssid=Neu\n"
+                      "c:s:name=Kueche\n"
+                      "c:i:interval=10\n"
+                      "gateway=192.168.1.300\n"
+                      "dns=192.168.1.1\n";
+        HostNvsStats stats = hostNvsStats();
+        String error;
+        CHECK(!m.importConfig(text, "", error));
+        CHECK(error.startsWith("Zeile 5:"));
+        CHECK(error.indexOf("IP") >= 0);
+        HostNvsStats after = hostNvsStats();
+        CHECK_EQ(after.writes, stats.writes);
+        CHECK_EQ(after.commits, stats.commits);
+        CHECK(!m.shouldReboot);
+        CHECK(m.ssid == "FRITZ!Box 7590 XY");
+
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        reloaded.setCustomDataSecret("token");
+        CHECK(reloaded.exportConfig() == before);
+
+        const char* const invalid[] = {
+            "[wwm-config v2]\n",
+            "[wwm-config v1]\nssid\n",
+            "[wwm-config v1]\nunbekannt=1\n",
+            "[wwm-config v1]\nssid=%4\n",
+            "[wwm-config v1]\nc:i:zahl=12x\n",
+            "[wwm-config v1]\nc:s:vierzehnzeichen=x\n",
+            "[wwm-config v1]\nuseStaticIP=1\nip=\n",
+            "[wwm-config v1]\nssid=123456789012345678901234567890123\n",
+        };
+        for (const char* t : invalid) {
+            CHECK(!m.importConfig(t, "", error));
+            CHECK(error.length() > 0);
+        }
+        CHECK_EQ(hostNvsStats().commits, stats.commits);
+    }
+
+    static void commitsAndReboot() {
+        WiFiWebManager m;
+        fillSource(m);
+        String exported = m.exportConfig(PASSPHRASE);
+
+        // Unveränderter Re-Import: nur Custom Data, ein Commit, kein Neustart
+        HostNvsStats before = hostNvsStats();
+        String error;
+        CHECK(m.importConfig(exported, PASSPHRASE, error));
+        HostNvsStats after = hostNvsStats();
+        CHECK_EQ(after.commits - before.commits, 1u);
+        CHECK(!m.shouldReboot);
+
+        // Nur Custom Data geändert: weiterhin ein Commit, kein Neustart
+        before = hostNvsStats();
+        CHECK(m.importConfig("[wwm-config v1]\nc:i:interval=7\nc:s:neu=x\nc:b:aktiv=0\n", "", error));
+        after = hostNvsStats();
+        CHECK_EQ(after.commits - before.commits, 1u);
+        CHECK_EQ(m.loadCustomDataInt("interval"), 7);
+        CHECK(!m.shouldReboot);
+
+        // Netzwerk geändert: ein Commit für Custom Data, einer für den Datensatz, dann Neustart
+        std::vector<String> parts = lines(exported);
+        parts[findLine(parts, "ssid=")] = "ssid=Anderes";
+        before = hostNvsStats();
+        CHECK(m.importConfig(join(parts), PASSPHRASE, error));
+        after = hostNvsStats();
+        CHECK_EQ(after.commits - before.commits, 2u);
+        CHECK(m.shouldReboot);
+        CHECK(m.ssid == "Anderes");
+    }
+
+    static void benchmark() {
+        WiFiWebManager m;
+        fillSource(m);
+        String plain = m.exportConfig();
+        String sealed = m.exportConfig(PASSPHRASE);
+        String error;
+        printf("Export/Import (Host; PBKDF2 mit %u Runden dominiert):\n", WiFiWebManagerSecret::KDF_ITERATIONS);
+        printf("  Export ohne Passphrase  %8.1f us\n", TestSupport::measureUs(2000, [&]() { m.exportConfig(); }));
+        printf("  Export mit Passphrase   %8.1f us\n",
+               TestSupport::measureUs(200, [&]() { m.exportConfig(PASSPHRASE); }));
+        printf("  Import ohne Passphrase  %8.1f us\n",
+               TestSupport::measureUs(2000, [&]() { m.importConfig(plain, "", error); }));
+        printf("  Import mit Passphrase   %8.1f us\n",
+               TestSupport::measureUs(200, [&]() { m.importConfig(sealed, PASSPHRASE, error); }));
+    }
+};
+
+int main(int argc, char** argv) {
+    WiFiWebManagerTest::roundTrip();
+    WiFiWebManagerTest::passphraseRequired();
+    WiFiWebManagerTest::tamperingDetected();
+    WiFiWebManagerTest::invalidLineWritesNothing();
+    WiFiWebManagerTest::commitsAndReboot();
+    if (TestSupport::benchRequested(argc, argv)) WiFiWebManagerTest::benchmark();
+    return TestSupport::finish("config_export_test");
+}
@@ -0,0 +1,282 @@
+// Netzwerk-Konfiguration als Datensatz in A/B-Slots (loadConfig()/saveConfig()):
+// Migration vom alten Key-pro-Feld-Format, Slot-Wechsel, abgebrochene Schreibvorgänge, CRC.
+// Mit --bench zusätzlich Start- und Speicherzeit im Vergleich zum alten Format.
+
+#include <WiFiWebManager.h>
+#include <nvs.h>
+
+#include <functional>
+
+#include "TestSupport.h"
+
+static const char* const LEGACY_KEYS[] = {"ssid", "pwd", "hostname", "useStaticIP", "ip", "gateway",
+                                          "subnet", "dns", "ntpEnable", "ntpServer", "bootAttempts"};
+
+class WiFiWebManagerTest {
+public:
+    // Altes Format wie bis 1.x: Strings, Bools und der Zähler als einzelne Keys
+    static void writeLegacyKey(Preferences& prefs, const char* key) {
+        if (!strcmp(key, "useStaticIP") || !strcmp(key, "ntpEnable")) prefs.putBool(key, true);
+        else if (!strcmp(key, "bootAttempts")) prefs.putInt(key, 2);
+        else prefs.putString(key, String("alt-") + key);
+    }
+
+    static bool migratedValue(WiFiWebManager& m, const char* key) {
+        if (!strcmp(key, "ssid")) return m.ssid == "alt-ssid";
+        if (!strcmp(key, "pwd")) return m.password == "alt-pwd";
+        if (!strcmp(key, "hostname")) return m.hostname == "alt-hostname";
+        if (!strcmp(key, "useStaticIP")) return m.useStaticIP;
+        if (!strcmp(key, "ip")) return m.ip == "alt-ip";
+        if (!strcmp(key, "gateway")) return m.gateway == "alt-gateway";
+        if (!strcmp(key, "subnet")) return m.subnet == "alt-subnet";
+        if (!strcmp(key, "dns")) return m.dns == "alt-dns";
+        if (!strcmp(key, "ntpEnable")) return m.ntpEnable;
+        if (!strcmp(key, "ntpServer")) return m.ntpServer == "alt-ntpServer";
+        if (!strcmp(key, "bootAttempts")) return m.wifiBootAttempts == 2;
+        return false;
+    }
+
+    static bool anyLegacyKeyLeft() {
+        Preferences prefs;
+        prefs.begin("netcfg", true);
+        bool found = false;
+        for (const char* key : LEGACY_KEYS) found = found || prefs.isKey(key);
+        prefs.end();
+        return found;
+    }
+
+    static size_t slotLength(int slot) {
+        Preferences prefs;
+        prefs.begin("netcfg", true);
+        size_t len = prefs.getBytesLength(slot ? "cfgB" : "cfgA");
+        prefs.end();
+        return len;
+    }
+
+    // Jeder einzelne alte Key muss die Migration auslösen (z.B. nach WLAN-Reset nur noch NTP-Keys)
+    static void legacyMigrationPerKey() {
+        for (const char* key : LEGACY_KEYS) {
+            hostNvsReset(false);
+            Preferences prefs;
+            prefs.begin("netcfg", false);
+            writeLegacyKey(prefs, key);
+            prefs.end();
+
+            WiFiWebManager m;
+            m.loadConfig();
+            if (!migratedValue(m, key)) printf("  Migration von '%s' fehlgeschlagen\n", key);
+            CHECK(migratedValue(m, key));
+            CHECK(!anyLegacyKeyLeft());
+            CHECK(slotLength(0) > 0);
+
+            WiFiWebManager reloaded;
+            reloaded.loadConfig();
+            CHECK(migratedValue(reloaded, key));
+        }
+    }
+
+    static void legacyMigrationComplete() {
+        hostNvsReset(false);
+        Preferences prefs;
+        prefs.begin("netcfg", false);
+        for (const char* key : LEGACY_KEYS) writeLegacyKey(prefs, key);
+        prefs.putString("custom1", "bleibt");
+        prefs.end();
+
+        WiFiWebManager m;
+        m.loadConfig();
+        for (const char* key : LEGACY_KEYS) CHECK(migratedValue(m, key));
+        CHECK(!anyLegacyKeyLeft());
+
+        prefs.begin("netcfg", true);
+        CHECK(prefs.getString("custom1", "") == "bleibt");
+        prefs.end();
+    }
+
+    static void emptyStoreUsesDefaults() {
+        hostNvsReset(false);
+        WiFiWebManager m;
+        m.loadConfig();
+        CHECK(m.ssid.length() == 0);
+        CHECK_EQ(m.wifiBootAttempts, 0);
+        CHECK(slotLength(0) == 0 && slotLength(1) == 0);
+    }
+
+    static void alternatingSlots() {
+        hostNvsReset(false);
+        WiFiWebManager m;
+        m.loadConfig();
+        m.ssid = "eins";
+        CHECK(m.saveConfig());
+        CHECK_EQ(m.configSlot, 0);
+        CHECK_EQ(m.configSeq, 1u);
+        m.ssid = "zwei";
+        CHECK(m.saveConfig());
+        CHECK_EQ(m.configSlot, 1);
+        CHECK_EQ(m.configSeq, 2u);
+        m.ssid = "drei";
+        CHECK(m.saveConfig());
+        CHECK_EQ(m.configSlot, 0);
+
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        CHECK(reloaded.ssid == "drei");
+        CHECK_EQ(reloaded.configSeq, 3u);
+    }
+
+    // Ein abgebrochener Schreibvorgang trifft nur den älteren Slot
+    static void tornWriteKeepsPreviousState() {
+        hostNvsReset(false);
+        WiFiWebManager m;
+        m.loadConfig();
+        m.ssid = "alt";
+        m.saveConfig();            // A #1
+        m.ssid = "gueltig";
+        m.saveConfig();            // B #2
+
+        uint8_t buf[512];
+        Preferences prefs;
+        prefs.begin("netcfg", false);
+        size_t len = prefs.getBytes("cfgA", buf, sizeof(buf));
+        prefs.putBytes("cfgA", buf, len / 2);
+        prefs.end();
+
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        CHECK(reloaded.ssid == "gueltig");
+        CHECK_EQ(reloaded.configSlot, 1);
+
+        // Nächster Schreibvorgang geht wieder in den defekten Slot
+        reloaded.ssid = "neu";
+        reloaded.saveConfig();
+        CHECK_EQ(reloaded.configSlot, 0);
+        WiFiWebManager again;
+        again.loadConfig();
+        CHECK(again.ssid == "neu");
+    }
+
+    static void crcMismatchFallsBack() {
+        hostNvsReset(false);
+        WiFiWebManager m;
+        m.loadConfig();
+        m.ssid = "aelter";
+        m.saveConfig();            // A #1
+        m.ssid = "neuer";
+        m.saveConfig();            // B #2
+
+        uint8_t buf[512];
+        Preferences prefs;
+        prefs.begin("netcfg", false);
+        size_t len = prefs.getBytes("cfgB", buf, sizeof(buf));
+        buf[len - 1] ^= 0x01;
+        prefs.putBytes("cfgB", buf, len);
+        prefs.end();
+
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        CHECK(reloaded.ssid == "aelter");
+
+        prefs.begin("netcfg", false);
+        len = prefs.getBytes("cfgA", buf, sizeof(buf));
+        buf[len - 1] ^= 0x01;
+        prefs.putBytes("cfgA", buf, len);
+        prefs.end();
+
+        WiFiWebManager none;
+        none.loadConfig();
+        CHECK(none.ssid.length() == 0);
+    }
+
+    static void sequenceWraps() {
+        hostNvsReset(false);
+        WiFiWebManager m;
+        m.loadConfig();
+        m.configSeq = 0xFFFFFFFE;
+        m.ssid = "vorher";
+        m.saveConfig();            // A #0xFFFFFFFF
+        m.ssid = "nachher";
+        m.saveConfig();            // B #0
+        CHECK_EQ(m.configSeq, 0u);
+
+        WiFiWebManager reloaded;
+        reloaded.loadConfig();
+        CHECK(reloaded.ssid == "nachher");
+    }
+
+    static void fillTypical(WiFiWebManager& m) {
+        m.ssid = "FRITZ!Box 7590 XY";
+        m.password = "ein-recht-langes-passwort-123";
+        m.hostname = "esp32-wohnzimmer";
+        m.useStaticIP = true;
+        m.ip = "192.168.178.50";
+        m.gateway = "192.168.178.1";
+        m.subnet = "255.255.255.0";
+        m.dns = "192.168.178.1";
+        m.ntpEnable = true;
+        m.ntpServer = "fritz.box, pool.ntp.org";
+    }
+
+    // Speichern wie bis 1.x: ein put (mit eigenem Commit) pro Feld
+    static void saveLegacy(WiFiWebManager& m) {
+        Preferences& prefs = m.prefs;
+        prefs.begin("netcfg", false);
+        prefs.putString("ssid", m.ssid);
+        prefs.putString("pwd", m.password);
+        prefs.putString("hostname", m.hostname);
+        prefs.putBool("useStaticIP", m.useStaticIP);
+        prefs.putString("ip", m.ip);
+        prefs.putString("gateway", m.gateway);
+        prefs.putString("subnet", m.subnet);
+        prefs.putString("dns", m.dns);
+        prefs.putBool("ntpEnable", m.ntpEnable);
+        prefs.putString("ntpServer", m.ntpServer);
+        prefs.putInt("bootAttempts", m.wifiBootAttempts);
+        prefs.end();
+    }
+
+    static void loadLegacy(WiFiWebManager& m) {
+        m.prefs.begin("netcfg", true);
+        m.loadLegacyConfig();
+        m.prefs.end();
+    }
+
+    static void report(const char* what, unsigned n, std::function<void()> fn) {
+        HostNvsStats before = hostNvsStats();
+        double us = TestSupport::measureUs(n, fn);
+        HostNvsStats after = hostNvsStats();
+        printf("  %-28s %8.2f us  %5.1f Lookups  %5.1f Schreibvorgänge  %5.1f Commits\n", what, us,
+               (double)(after.reads - before.reads) / n, (double)(after.writes - before.writes) / n,
+               (double)(after.commits - before.commits) / n);
+    }
+
+    static void benchmark() {
+        const unsigned n = 20000;
+        printf("Start/Speichern je Aufruf (Host, NVS im RAM; auf dem Gerät zählt v.a. jeder Schreibvorgang):\n");
+
+        hostNvsReset(false);
+        WiFiWebManager record;
+        fillTypical(record);
+        record.saveConfig();
+        report("Start: Datensatz A/B", n, [&]() { record.loadConfig(); });
+        report("Speichern: Datensatz A/B", n, [&]() { record.saveConfig(); });
+
+        hostNvsReset(false);
+        WiFiWebManager legacy;
+        fillTypical(legacy);
+        saveLegacy(legacy);
+        report("Start: Key pro Feld (alt)", n, [&]() { loadLegacy(legacy); });
+        report("Speichern: Key pro Feld (alt)", n, [&]() { saveLegacy(legacy); });
+    }
+};
+
+int main(int argc, char** argv) {
+    WiFiWebManagerTest::legacyMigrationPerKey();
+    WiFiWebManagerTest::legacyMigrationComplete();
+    WiFiWebManagerTest::emptyStoreUsesDefaults();
+    WiFiWebManagerTest::alternatingSlots();
+    WiFiWebManagerTest::tornWriteKeepsPreviousState();
+    WiFiWebManagerTest::crcMismatchFallsBack();
+    WiFiWebManagerTest::sequenceWraps();
+    if (TestSupport::benchRequested(argc, argv)) WiFiWebManagerTest::benchmark();
+    return TestSupport::finish("config_record_test");
+}
@@ -0,0 +1,315 @@
+// gzip-Kompressor (WiFiWebManagerGzip): Deflater/compress() gegen zlib inflate - leere Eingabe,
+// ein Byte, genau eine Fensterlänge, Distanzen an der Fenstergrenze, unkomprimierbare Daten und
+// lange Wiederholungen; beim Streamen dieselben Bytes bei jeder Puffergröße von read().
+// Danach die eingebauten Seiten über den Webserver der Host-Nachbildung (mit und ohne gzip).
+// Mit --bench: Laufzeit und Größe je Seite (roh / Deflater / zlib -9).
+//
+//   ./build/deflate_test [--port N] [--bench]
+
+#include <WiFiWebManager.h>
+#include <WiFiWebManagerGzip.h>
+#include <HostRuntime.h>
+#include <nvs.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <random>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+#include <zlib.h>
+
+#include "TestSupport.h"
+
+using WiFiWebManagerGzip::WINDOW_SIZE;
+
+static std::mt19937 rng(1234);
+
+// Vollständiger gzip-Stream -> Klartext; false bei Formatfehler, CRC/Längenfehler oder Restdaten
+static bool inflateGzip(const std::vector<uint8_t>& in, std::string& out) {
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    if (inflateInit2(&z, 16 + MAX_WBITS) != Z_OK) return false;
+    z.next_in = const_cast<uint8_t*>(in.data());
+    z.avail_in = in.size();
+    out.clear();
+    int rc;
+    do {
+        uint8_t buf[4096];
+        z.next_out = buf;
+        z.avail_out = sizeof(buf);
+        rc = inflate(&z, Z_NO_FLUSH);
+        out.append((const char*)buf, sizeof(buf) - z.avail_out);
+    } while (rc == Z_OK);
+    bool ok = rc == Z_STREAM_END && z.avail_in == 0;
+    inflateEnd(&z);
+    return ok;
+}
+
+static size_t zlibGzipSize(const std::string& data, int level) {
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    deflateInit2(&z, level, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::vector<uint8_t> out(deflateBound(&z, data.size()));
+    z.next_in = (uint8_t*)data.data();
+    z.avail_in = data.size();
+    z.next_out = out.data();
+    z.avail_out = out.size();
+    deflate(&z, Z_FINISH);
+    size_t n = z.total_out;
+    deflateEnd(&z);
+    return n;
+}
+
+static std::vector<uint8_t> deflated(const std::string& data) {
+    std::vector<uint8_t> out;
+    CHECK(WiFiWebManagerGzip::compress((const uint8_t*)data.data(), data.size(), out));
+    return out;
+}
+
+static void checkRoundTrip(const std::string& data, const char* name) {
+    std::vector<uint8_t> gz = deflated(data);
+    std::string back;
+    bool ok = inflateGzip(gz, back) && back == data;
+    if (!ok) printf("  Roundtrip fehlgeschlagen: %s (%u Bytes)\n", name, (unsigned)data.size());
+    CHECK(ok);
+    CHECK(gz.size() >= 18 && gz[0] == 0x1f && gz[1] == 0x8b);
+    // Fest codierte Literale brauchen höchstens 9 Bit: nie mehr als 9/8 der Eingabe plus Rahmen
+    CHECK(gz.size() <= data.size() * 9 / 8 + 10 + 8 + 2);
+}
+
+static std::string randomBytes(size_t len) {
+    std::string s(len, '\0');
+    for (auto& c : s) c = (char)rng();
+    return s;
+}
+
+static std::string htmlLike(size_t len) {
+    static const char* const parts[] = {"<div class='status-box'>", "<p><strong>", "</strong> ", "</p>",
+                                        "<option value='", "'>", "</option>", "WLAN-", "192.168.178.",
+                                        "<input name='", "' value='", "'>"};
+    std::string s;
+    while (s.size() < len) {
+        s += parts[rng() % 12];
+        s += std::to_string(rng() % 300);
+    }
+    s.resize(len);
+    return s;
+}
+
+static void edgeCases() {
+    checkRoundTrip("", "leer");
+    checkRoundTrip("x", "ein Byte");
+    checkRoundTrip("ab", "zwei Bytes");
+    checkRoundTrip("abc", "MIN_MATCH");
+    checkRoundTrip("abcabc", "erster Treffer");
+    checkRoundTrip(htmlLike(WINDOW_SIZE), "genau ein Fenster");
+    checkRoundTrip(htmlLike(WINDOW_SIZE + 1), "Fenster + 1");
+    checkRoundTrip(randomBytes(WINDOW_SIZE), "Zufall, ein Fenster");
+    checkRoundTrip(randomBytes(64 * 1024), "Zufall 64 KB");
+    checkRoundTrip(std::string(100000, '\0'), "100000 Nullbytes");
+    checkRoundTrip(std::string(258, 'a') + "b" + std::string(259, 'a'), "MAX_MATCH");
+    checkRoundTrip(htmlLike(50000), "HTML-artig 50 KB");
+    for (int c = 0; c < 256; c++) checkRoundTrip(std::string(1, (char)c) + "-" + std::string(1, (char)c), "Literal");
+
+    // Wiederholung genau an der Fenstergrenze: Distanz WINDOW_SIZE - 1 ist erlaubt, WINDOW_SIZE nicht
+    for (size_t dist : {WINDOW_SIZE - 2, WINDOW_SIZE - 1, WINDOW_SIZE, WINDOW_SIZE + 1}) {
+        std::string block = randomBytes(64);
+        std::string data = block + randomBytes(dist - block.size()) + block;
+        checkRoundTrip(data, "Distanz an der Fenstergrenze");
+    }
+    std::string repeated = randomBytes(WINDOW_SIZE - 1);
+    std::vector<uint8_t> gz = deflated(repeated + repeated);
+    CHECK(gz.size() < repeated.size() * 9 / 8 + 64);   // zweite Hälfte als Treffer codiert
+
+    // CRC wie zlib, auch fortgesetzt
+    std::string text = htmlLike(3000);
+    const uint8_t* p = (const uint8_t*)text.data();
+    CHECK_EQ(WiFiWebManagerGzip::crc32(0, p, text.size()), (uint32_t)::crc32(0, p, text.size()));
+    CHECK_EQ(WiFiWebManagerGzip::crc32(WiFiWebManagerGzip::crc32(0, p, 1000), p + 1000, 2000),
+             (uint32_t)::crc32(0, p, text.size()));
+}
+
+// read() mit beliebigen Puffergrößen liefert exakt denselben Stream wie compress()
+static void streamedChunks() {
+    std::string inputs[] = {"", "x", htmlLike(WINDOW_SIZE), randomBytes(5000), htmlLike(20000)};
+    for (const auto& data : inputs) {
+        std::vector<uint8_t> whole = deflated(data);
+        for (size_t chunk : {1, 2, 3, 7, 63, 64, 65, 255, 1436, 4096}) {
+            WiFiWebManagerGzip::Deflater deflater((const uint8_t*)data.data(), data.size());
+            CHECK(deflater.begin());
+            std::vector<uint8_t> out;
+            std::vector<uint8_t> buf(chunk);
+            size_t n;
+            size_t calls = 0;
+            while ((n = deflater.read(buf.data(), chunk)) > 0) {
+                CHECK(n <= chunk);
+                out.insert(out.end(), buf.begin(), buf.begin() + n);
+                calls++;
+            }
+            CHECK(out == whole);
+            CHECK(deflater.finished());
+            CHECK_EQ(deflater.totalOut(), out.size());
+            CHECK_EQ(deflater.read(buf.data(), chunk), 0u);
+            // Volle Puffer bis auf den letzten: der Server schickt keine unnötig kleinen Chunks
+            CHECK_EQ(calls, (out.size() + chunk - 1) / chunk);
+        }
+    }
+
+    // Ohne begin() (kein Speicher) entsteht kein halber Stream
+    std::string data = htmlLike(1000);
+    WiFiWebManagerGzip::Deflater deflater((const uint8_t*)data.data(), data.size());
+    uint8_t buf[64];
+    CHECK_EQ(deflater.read(buf, sizeof(buf)), 0u);
+}
+
+// ---- Seiten über den Webserver der Host-Nachbildung ----
+
+struct HttpResponse {
+    int status = 0;
+    std::string head;
+    std::string body;
+};
+
+static std::string dechunk(const std::string& in) {
+    std::string out;
+    size_t pos = 0;
+    while (pos < in.size()) {
+        size_t eol = in.find("\r\n", pos);
+        if (eol == std::string::npos) break;
+        size_t len = strtoul(in.c_str() + pos, nullptr, 16);
+        if (len == 0) break;
+        out.append(in, eol + 2, len);
+        pos = eol + 2 + len + 2;
+    }
+    return out;
+}
+
+static HttpResponse httpGet(uint16_t port, const char* path, bool gzip) {
+    HttpResponse r;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        return r;
+    }
+    std::string req = std::string("GET ") + path + " HTTP/1.1\r\nHost: esp32.local\r\nConnection: close\r\n";
+    if (gzip) req += "Accept-Encoding: gzip, deflate\r\n";
+    req += "\r\n";
+    send(fd, req.data(), req.size(), 0);
+    std::string raw;
+    char buf[4096];
+    ssize_t n;
+    while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) raw.append(buf, n);
+    close(fd);
+
+    size_t headEnd = raw.find("\r\n\r\n");
+    if (headEnd == std::string::npos) return r;
+    r.head = raw.substr(0, headEnd);
+    r.body = raw.substr(headEnd + 4);
+    r.status = atoi(r.head.c_str() + 9);
+    if (r.head.find("Transfer-Encoding: chunked") != std::string::npos) r.body = dechunk(r.body);
+    return r;
+}
+
+static uint16_t argPort(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!strcmp(argv[i], "--port")) return (uint16_t)atoi(argv[i + 1]);
+    }
+    return (uint16_t)(20000 + getpid() % 20000);
+}
+
+struct Page {
+    const char* label;
+    const char* path;
+    uint8_t extraNetworks;
+};
+
+static const Page PAGES[] = {
+    {"/", "/", 0},
+    {"/wlan (4 SSIDs)", "/wlan", 0},
+    {"/wlan (40 SSIDs)", "/wlan", 36},
+    {"/ntp", "/ntp", 0},
+    {"/update", "/update", 0},
+};
+
+class WiFiWebManagerTest {
+public:
+    // Nur der Webserver - ohne WLAN-Verbindung, mDNS und Captive-Portal-DNS
+    static void serve(WiFiWebManager& m) {
+        hostNvsReset(false);
+        m.loadConfig();
+        m.setupWebServer();
+        m.server.begin();
+    }
+};
+
+// Eingebaute Seiten mit und ohne Accept-Encoding: gzip; die gzip-Antwort entpackt wie die rohe
+static void builtInPages(uint16_t port, std::vector<std::string>& rendered) {
+    for (const Page& page : PAGES) {
+        WiFi.hostSetExtraNetworks(page.extraNetworks);
+        HttpResponse raw = httpGet(port, page.path, false);
+        HttpResponse gz = httpGet(port, page.path, true);
+        CHECK_EQ(raw.status, 200);
+        CHECK_EQ(gz.status, 200);
+        CHECK(raw.body.find("</html>") != std::string::npos);
+        rendered.push_back(raw.body);
+
+        bool compressed = gz.head.find("Content-Encoding: gzip") != std::string::npos;
+        CHECK_EQ(compressed, raw.body.size() >= 1024);      // Standard-Schwelle von setCompression()
+        CHECK(gz.head.find("Vary: Accept-Encoding") != std::string::npos);
+        if (compressed) {
+            std::string back;
+            CHECK(inflateGzip(std::vector<uint8_t>(gz.body.begin(), gz.body.end()), back));
+            // Laufzeit und freier Heap im Statusteil ändern sich zwischen den Abrufen
+            CHECK(back.compare(0, 200, raw.body, 0, 200) == 0);
+            CHECK(back.find("</html>") != std::string::npos);
+        }
+    }
+    WiFi.hostSetExtraNetworks(0);
+}
+
+static void benchmark(const std::vector<std::string>& rendered) {
+    printf("Seite              roh    Deflater         zlib -9   compress()  read(1436)\n");
+    for (size_t i = 0; i < rendered.size(); i++) {
+        const std::string& html = rendered[i];
+        std::vector<uint8_t> gz = deflated(html);
+        double us = TestSupport::measureUs(2000, [&]() { deflated(html); });
+        double streamedUs = TestSupport::measureUs(2000, [&]() {
+            WiFiWebManagerGzip::Deflater deflater((const uint8_t*)html.data(), html.size());
+            deflater.begin();
+            uint8_t buf[1436];
+            while (deflater.read(buf, sizeof(buf)) > 0) {}
+        });
+        size_t z9 = zlibGzipSize(html, 9);
+        printf("%-16s %5u B  %5u B (%3.0f%%)  %5u B (%3.0f%%)  %7.1f us  %7.1f us\n", PAGES[i].label,
+               (unsigned)html.size(), (unsigned)gz.size(), 100.0 * gz.size() / html.size(), (unsigned)z9,
+               100.0 * z9 / html.size(), us, streamedUs);
+    }
+    std::string big = htmlLike(32 * 1024);
+    double crcUs = TestSupport::measureUs(200, [&]() {
+        WiFiWebManagerGzip::crc32(0, (const uint8_t*)big.data(), big.size());
+    });
+    printf("crc32 (bitweise)   %.1f MB/s\n", big.size() / crcUs);
+}
+
+int main(int argc, char** argv) {
+    edgeCases();
+    streamedChunks();
+
+    uint16_t port = argPort(argc, argv);
+    HostRuntime::setHttpPort(port);
+    WiFiWebManager manager;
+    WiFiWebManagerTest::serve(manager);
+    std::vector<std::string> rendered;
+    builtInPages(port, rendered);
+    CHECK_EQ(rendered.size(), sizeof(PAGES) / sizeof(PAGES[0]));
+
+    if (TestSupport::benchRequested(argc, argv)) benchmark(rendered);
+    return TestSupport::finish("deflate_test");
+}
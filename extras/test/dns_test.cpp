@@ -0,0 +1,246 @@
+// Captive-Portal-DNS (WiFiWebManagerDns::buildResponse): Paketformat und Sonderfälle,
+// dann Ende-zu-Ende über einen lokalen UDP-Socket wie in processDNS().
+// Mit --bench: Kosten pro Anfrage (nur buildResponse und kompletter Roundtrip über Loopback).
+
+#include <WiFiWebManagerDns.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "TestSupport.h"
+
+using WiFiWebManagerDns::buildResponse;
+using WiFiWebManagerDns::MAX_PACKET;
+
+static const uint8_t AP_IP[4] = {192, 168, 4, 1};
+
+static std::vector<uint8_t> query(const char* name, uint16_t qtype, uint16_t id = 0x1234, bool edns = false) {
+    std::vector<uint8_t> q = {(uint8_t)(id >> 8), (uint8_t)id, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, (uint8_t)(edns ? 1 : 0)};
+    const char* label = name;
+    while (*label) {
+        const char* dot = strchr(label, '.');
+        size_t len = dot ? (size_t)(dot - label) : strlen(label);
+        q.push_back((uint8_t)len);
+        q.insert(q.end(), label, label + len);
+        label += len + (dot ? 1 : 0);
+    }
+    q.push_back(0);
+    q.push_back(qtype >> 8);
+    q.push_back(qtype & 0xFF);
+    q.push_back(0);
+    q.push_back(1);
+    if (edns) {
+        const uint8_t opt[] = {0, 0, 41, 0x10, 0, 0, 0, 0, 0, 0, 0};
+        q.insert(q.end(), opt, opt + sizeof(opt));
+    }
+    return q;
+}
+
+static size_t answer(std::vector<uint8_t>& packet, size_t capacity = MAX_PACKET) {
+    size_t len = packet.size();
+    packet.resize(capacity);
+    size_t out = buildResponse(packet.data(), len, capacity, AP_IP);
+    packet.resize(out);
+    return out;
+}
+
+static void aQuery() {
+    std::vector<uint8_t> q = query("captive.apple.com", 1);
+    size_t questionEnd = q.size();
+    std::vector<uint8_t> r = q;
+    CHECK_EQ(answer(r), questionEnd + 16);
+    CHECK(r[0] == 0x12 && r[1] == 0x34);                 // ID übernommen
+    CHECK_EQ(r[2], 0x85);                                 // QR, AA, RD
+    CHECK_EQ(r[3], 0x80);                                 // RA, NOERROR
+    CHECK(r[5] == 1 && r[7] == 1 && r[9] == 0 && r[11] == 0);
+    CHECK(memcmp(r.data() + 12, q.data() + 12, questionEnd - 12) == 0);
+    const uint8_t* rr = r.data() + questionEnd;
+    CHECK(rr[0] == 0xC0 && rr[1] == 0x0C);                // Zeiger auf den Namen der Frage
+    CHECK(rr[3] == 1 && rr[5] == 1 && rr[9] == 60 && rr[11] == 4);
+    CHECK(memcmp(rr + 12, AP_IP, 4) == 0);
+}
+
+static void otherTypes() {
+    std::vector<uint8_t> any = query("example.com", 255);
+    CHECK_EQ(answer(any), query("example.com", 255).size() + 16);
+
+    std::vector<uint8_t> aaaa = query("example.com", 28);
+    size_t len = aaaa.size();
+    CHECK_EQ(answer(aaaa), len);                           // leere Antwort, kein Record
+    CHECK(aaaa[7] == 0 && aaaa[3] == 0x80);
+
+    // EDNS-OPT im Additional-Teil wird nicht zurückgeschickt
+    std::vector<uint8_t> edns = query("example.com", 1, 7, true);
+    size_t plain = query("example.com", 1).size();
+    CHECK_EQ(answer(edns), plain + 16);
+    CHECK_EQ(edns[11], 0);
+
+    // Zu wenig Platz für den A-Record: Antwort ohne Record statt Überlauf
+    std::vector<uint8_t> tight = query("example.com", 1);
+    CHECK_EQ(answer(tight, tight.size() + 15), plain);
+}
+
+static void rejectedPackets() {
+    std::vector<uint8_t> shortPacket = {1, 2, 3};
+    CHECK_EQ(answer(shortPacket), 0u);
+
+    std::vector<uint8_t> response = query("example.com", 1);
+    response[2] |= 0x80;
+    CHECK_EQ(answer(response), 0u);
+
+    std::vector<uint8_t> truncated = query("example.com", 1);
+    truncated.resize(truncated.size() - 3);
+    CHECK_EQ(answer(truncated), 0u);
+
+    std::vector<uint8_t> compressed = query("example.com", 1);
+    compressed[12] = 0xC0;
+    CHECK_EQ(answer(compressed), 0u);
+
+    // Label-Länge zeigt hinter das Paketende
+    std::vector<uint8_t> overrun = query("example.com", 1);
+    overrun[12] = 60;
+    CHECK_EQ(answer(overrun), 0u);
+
+    // Mehrere Fragen oder anderer Opcode: NOTIMP, nur Header
+    std::vector<uint8_t> two = query("example.com", 1);
+    two[5] = 2;
+    CHECK_EQ(answer(two), 12u);
+    CHECK(two[2] & 0x80);
+    CHECK_EQ(two[3] & 0x0F, 4);
+
+    std::vector<uint8_t> status = query("example.com", 1);
+    status[2] = 0x10;                                      // Opcode 2 (STATUS)
+    CHECK_EQ(answer(status), 12u);
+    CHECK_EQ(status[3] & 0x0F, 4);
+}
+
+// Zufällige Pakete dürfen nie über den Puffer hinaus schreiben oder lesen
+static void randomPackets() {
+    uint32_t seed = 12345;
+    for (int i = 0; i < 200000; i++) {
+        uint8_t buf[MAX_PACKET + 16];
+        memset(buf, 0xA5, sizeof(buf));
+        seed = seed * 1103515245 + 12345;
+        size_t len = 12 + (seed >> 16) % 60;
+        for (size_t j = 0; j < len; j++) {
+            seed = seed * 1103515245 + 12345;
+            buf[j] = (uint8_t)(seed >> 16);
+        }
+        if (i & 1) buf[2] &= 0x07;                         // meist gültiger Header
+        if (i & 2) buf[4] = 0, buf[5] = 1;
+        size_t out = buildResponse(buf, len, MAX_PACKET, AP_IP);
+        CHECK(out <= MAX_PACKET);
+        CHECK(buf[MAX_PACKET] == 0xA5);
+    }
+}
+
+// Server wie processDNS(): nicht blockierendes recvfrom, Antwort im selben Puffer
+struct LoopbackServer {
+    int fd = -1;
+    uint16_t port = 0;
+    std::atomic<bool> running{true};
+    std::thread thread;
+
+    LoopbackServer() {
+        fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(fd, (struct sockaddr*)&addr, &len);
+        port = ntohs(addr.sin_port);
+        struct timeval tv = {0, 100000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        thread = std::thread([this]() {
+            uint8_t buf[MAX_PACKET];
+            while (running) {
+                struct sockaddr_in from;
+                socklen_t fromLen = sizeof(from);
+                int len = recvfrom(fd, buf, sizeof(buf), 0, (struct sockaddr*)&from, &fromLen);
+                if (len <= 0) continue;
+                size_t out = buildResponse(buf, len, sizeof(buf), AP_IP);
+                if (out) sendto(fd, buf, out, 0, (struct sockaddr*)&from, fromLen);
+            }
+        });
+    }
+
+    ~LoopbackServer() {
+        running = false;
+        thread.join();
+        close(fd);
+    }
+};
+
+struct Client {
+    int fd;
+    struct sockaddr_in server;
+
+    explicit Client(uint16_t port) {
+        fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        memset(&server, 0, sizeof(server));
+        server.sin_family = AF_INET;
+        server.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        server.sin_port = htons(port);
+        struct timeval tv = {1, 0};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+    ~Client() { close(fd); }
+
+    int exchange(const std::vector<uint8_t>& q, uint8_t* reply, size_t capacity) {
+        sendto(fd, q.data(), q.size(), 0, (struct sockaddr*)&server, sizeof(server));
+        return recv(fd, reply, capacity, 0);
+    }
+};
+
+static void loopback() {
+    LoopbackServer server;
+    Client client(server.port);
+    uint8_t reply[MAX_PACKET];
+
+    std::vector<uint8_t> q = query("connectivitycheck.gstatic.com", 1, 0xBEEF);
+    int len = client.exchange(q, reply, sizeof(reply));
+    CHECK_EQ(len, (int)q.size() + 16);
+    CHECK(len > 0 && reply[0] == 0xBE && reply[1] == 0xEF);
+    CHECK(len > 4 && memcmp(reply + len - 4, AP_IP, 4) == 0);
+
+    // Verworfene Pakete bekommen keine Antwort, der Server läuft weiter
+    std::vector<uint8_t> bogus = {0, 0, 0x80, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0};
+    sendto(client.fd, bogus.data(), bogus.size(), 0, (struct sockaddr*)&client.server, sizeof(client.server));
+    len = client.exchange(query("msftconnecttest.com", 1, 2), reply, sizeof(reply));
+    CHECK(len > 1 && reply[1] == 2);
+}
+
+static void benchmark() {
+    std::vector<uint8_t> q = query("captive.apple.com", 1);
+    uint8_t buf[MAX_PACKET];
+    double buildUs = TestSupport::measureUs(1000000, [&]() {
+        memcpy(buf, q.data(), q.size());
+        buildResponse(buf, q.size(), sizeof(buf), AP_IP);
+    });
+
+    LoopbackServer server;
+    Client client(server.port);
+    const unsigned n = 20000;
+    unsigned ok = 0;
+    double rttUs = TestSupport::measureUs(n, [&]() {
+        if (client.exchange(q, buf, sizeof(buf)) == (int)q.size() + 16) ok++;
+    });
+    printf("  buildResponse: %.1f ns/Anfrage\n", buildUs * 1000);
+    printf("  Loopback-Roundtrip: %.1f us/Anfrage (%u/%u beantwortet)\n", rttUs, ok, n);
+}
+
+int main(int argc, char** argv) {
+    aQuery();
+    otherTypes();
+    rejectedPackets();
+    randomPackets();
+    loopback();
+    if (TestSupport::benchRequested(argc, argv)) benchmark();
+    return TestSupport::finish("dns_test");
+}
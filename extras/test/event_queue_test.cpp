@@ -0,0 +1,132 @@
+// Lock-freie Ereignis-Queue (WiFiWebManagerEventQueue): Reihenfolge, Überlauf und Umlauf
+// einzeln, dann 4 Produzenten-Threads gegen einen Konsumenten wie WLAN-, Web- und OTA-Kontext
+// gegen loop(). Jedes Ereignis muss genau einmal und pro Produzent in Reihenfolge ankommen.
+// Mit --bench: Durchsatz mit einem und mit vier Produzenten.
+
+#include <WiFiWebManagerEvents.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "TestSupport.h"
+
+static void fifoAndOverflow() {
+    WiFiWebManagerEventQueue<int, 4> q;
+    int v = 0;
+    CHECK(!q.pop(v));
+    for (int i = 0; i < 4; i++) CHECK(q.push(i));
+    CHECK(!q.push(99));                                 // voll: verworfen, nicht überschrieben
+    CHECK_EQ(q.overflows(), 1u);
+    for (int i = 0; i < 4; i++) {
+        CHECK(q.pop(v));
+        CHECK_EQ(v, i);
+    }
+    CHECK(!q.pop(v));
+
+    // Viele Umläufe mit wechselndem Füllstand
+    int next = 0, expected = 0;
+    for (int round = 0; round < 1000; round++) {
+        for (int i = 0; i < 1 + round % 4; i++) CHECK(q.push(next++));
+        while (q.pop(v)) CHECK_EQ(v, expected++);
+    }
+    CHECK_EQ(expected, next);
+    CHECK_EQ(q.overflows(), 1u);
+}
+
+static const int PRODUCERS = 4;
+
+// value = Produzent << 24 | laufende Nummer
+struct StressResult {
+    uint32_t received = 0;
+    uint32_t outOfOrder = 0;
+    uint32_t dropped = 0;
+};
+
+// retry = true: Produzent wiederholt bei voller Queue (alles muss ankommen),
+// sonst verwirft er wie publishEvent() und zählt nur mit
+static StressResult stress(uint32_t perProducer, bool retry) {
+    WiFiWebManagerEventQueue<WiFiWebManagerEventData, 32> q;   // Größe wie WiFiWebManager::EVENT_QUEUE_SIZE
+
+    std::atomic<int> running{PRODUCERS};
+    std::atomic<uint32_t> dropped{0};
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; p++) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < perProducer; i++) {
+                WiFiWebManagerEventData event = {WiFiWebManagerEvent::OtaProgress, (int32_t)((p << 24) | i), i};
+                while (!q.push(event)) {
+                    if (!retry) {
+                        dropped++;
+                        break;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+            running--;
+        });
+    }
+
+    StressResult result;
+    int32_t last[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++) last[p] = -1;
+    WiFiWebManagerEventData event;
+    for (;;) {
+        bool done = running == 0;           // vor pop() lesen, sonst könnten Reste verloren gehen
+        bool any = false;
+        while (q.pop(event)) {
+            any = true;
+            int p = event.value >> 24;
+            int32_t seq = event.value & 0xFFFFFF;
+            if (p < 0 || p >= PRODUCERS || seq <= last[p] || (retry && seq != last[p] + 1) ||
+                (uint32_t)seq != event.timestamp) {
+                result.outOfOrder++;
+            }
+            if (p >= 0 && p < PRODUCERS) last[p] = seq;
+            result.received++;
+        }
+        if (done && !any) break;
+        if (!any) std::this_thread::yield();   // auch auf einem Kern müssen die Produzenten drankommen
+    }
+    for (auto& t : producers) t.join();
+    result.dropped = dropped;
+    if (!retry) CHECK_EQ(q.overflows(), result.dropped);
+    return result;
+}
+
+static void fourProducers() {
+    const uint32_t n = 200000;
+    StressResult all = stress(n, true);
+    CHECK_EQ(all.received, PRODUCERS * n);
+    CHECK_EQ(all.outOfOrder, 0u);
+
+    // Verwerfen wie publishEvent(): Angekommenes plus Verworfenes ergibt genau alle Ereignisse
+    StressResult lossy = stress(n, false);
+    CHECK_EQ(lossy.received + lossy.dropped, PRODUCERS * n);
+    CHECK_EQ(lossy.outOfOrder, 0u);
+    printf("  4 Produzenten x %u: %u zugestellt (mit Wiederholung), %u zugestellt / %u verworfen (ohne)\n", n,
+           all.received, lossy.received, lossy.dropped);
+}
+
+static void benchmark() {
+    WiFiWebManagerEventQueue<WiFiWebManagerEventData, 32> q;
+    WiFiWebManagerEventData event = {WiFiWebManagerEvent::Connected, 0, 0};
+    double singleUs = TestSupport::measureUs(10000000, [&]() {
+        q.push(event);
+        q.pop(event);
+    });
+    printf("  push+pop, ein Thread: %.1f ns\n", singleUs * 1000);
+
+    const uint32_t n = 500000;
+    auto start = std::chrono::steady_clock::now();
+    StressResult r = stress(n, true);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    printf("  4 Produzenten, 1 Konsument: %.1f ns/Ereignis (%u Ereignisse)\n", us * 1000 / r.received, r.received);
+}
+
+int main(int argc, char** argv) {
+    fifoAndOverflow();
+    fourProducers();
+    if (TestSupport::benchRequested(argc, argv)) benchmark();
+    return TestSupport::finish("event_queue_test");
+}
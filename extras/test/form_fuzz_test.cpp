@@ -0,0 +1,214 @@
+// Fuzzing der FormBinder-Parser (parseIPv4/parseInt/parseBool) gegen Referenzen aus
+// std::regex und strtol: zufällige und gezielt verfälschte Eingaben, gleiche Entscheidung
+// und gleicher Wert. Mit --bench zusätzlich Laufzeit im Vergleich zu sscanf/strtol.
+//
+//   ./build/form_fuzz_test [--seed N] [--runs N] [--bench]
+
+#include <WiFiWebManagerForm.h>
+
+#include <cerrno>
+#include <climits>
+#include <random>
+#include <regex>
+#include <string>
+
+#include "TestSupport.h"
+
+static std::mt19937 rng;
+
+static unsigned argValue(int argc, char** argv, const char* name, unsigned fallback) {
+    for (int i = 1; i + 1 < argc; i++) {
+        if (!strcmp(argv[i], name)) return (unsigned)strtoul(argv[i + 1], nullptr, 10);
+    }
+    return fallback;
+}
+
+static std::string randomString(const char* alphabet, size_t maxLen) {
+    size_t alphabetLen = strlen(alphabet);
+    std::string s;
+    size_t len = rng() % (maxLen + 1);
+    for (size_t i = 0; i < len; i++) {
+        // Gelegentlich beliebige Bytes (Steuerzeichen, UTF-8-Reste), sonst aus dem Alphabet
+        s += (rng() % 40 == 0) ? (char)(1 + rng() % 255) : alphabet[rng() % alphabetLen];
+    }
+    return s;
+}
+
+// Gültige Eingabe an einer Stelle verändern: Zeichen ersetzen, einfügen oder löschen
+static std::string mutate(std::string s, const char* alphabet) {
+    size_t pos = s.empty() ? 0 : rng() % (s.size() + 1);
+    char c = alphabet[rng() % strlen(alphabet)];
+    switch (rng() % 3) {
+        case 0: if (pos < s.size()) s[pos] = c; break;
+        case 1: s.insert(s.begin() + pos, c); break;
+        case 2: if (pos < s.size()) s.erase(pos, 1); break;
+    }
+    return s;
+}
+
+// ---- IPv4 ----
+
+static const std::regex IPV4_RE("^([0-9]{1,3})\\.([0-9]{1,3})\\.([0-9]{1,3})\\.([0-9]{1,3})$");
+
+static bool referenceIPv4(const std::string& s, uint8_t out[4]) {
+    std::smatch m;
+    if (!std::regex_match(s, m, IPV4_RE)) return false;
+    for (int i = 0; i < 4; i++) {
+        long v = strtol(m[i + 1].str().c_str(), nullptr, 10);
+        if (v > 255) return false;
+        out[i] = (uint8_t)v;
+    }
+    return true;
+}
+
+static std::string ipCandidate() {
+    switch (rng() % 4) {
+        case 0: return randomString("0123456789.", 20);
+        case 1: return randomString("0123456789.-+ x", 20);
+        default: {
+            std::string s = std::to_string(rng() % 300) + "." + std::to_string(rng() % 300) + "." +
+                            std::to_string(rng() % 300) + "." + std::to_string(rng() % 300);
+            return (rng() % 2) ? mutate(s, "0123456789. ") : s;
+        }
+    }
+}
+
+static unsigned fuzzIPv4(unsigned runs) {
+    unsigned valid = 0;
+    for (unsigned i = 0; i < runs; i++) {
+        std::string s = ipCandidate();
+        uint8_t got[4] = {0}, expected[4] = {0};
+        bool ok = FormBinder::parseIPv4(s.c_str(), got);
+        bool ref = referenceIPv4(s, expected);
+        if (ok != ref || (ok && memcmp(got, expected, 4) != 0)) {
+            printf("  parseIPv4('%s'): %d, Referenz %d\n", s.c_str(), ok, ref);
+            TestSupport::failures()++;
+        }
+        if (ok) valid++;
+    }
+    return valid;
+}
+
+// ---- Ganzzahlen ----
+
+static const std::regex INT_RE("^-?[0-9]+$");
+
+static bool referenceInt(const std::string& s, long& out) {
+    if (!std::regex_match(s, INT_RE)) return false;   // strtol allein nähme auch " 1", "+1", "1x"
+    errno = 0;
+    out = strtol(s.c_str(), nullptr, 10);
+    return errno != ERANGE;
+}
+
+static std::string intCandidate() {
+    switch (rng() % 4) {
+        case 0: return randomString("0123456789-+ x", 24);
+        case 1: return std::to_string((long)(((uint64_t)rng() << 32) | rng()));
+        case 2: {
+            // Rund um die Grenzen von long
+            static const char* const edges[] = {"9223372036854775807", "-9223372036854775808",
+                                                "9223372036854775808", "-9223372036854775809",
+                                                "99999999999999999999", "-0", "0000000000000000000001"};
+            std::string s = edges[rng() % (sizeof(edges) / sizeof(edges[0]))];
+            return (rng() % 2) ? mutate(s, "0123456789-") : s;
+        }
+        default: return mutate(std::to_string((int)rng()), "0123456789- ");
+    }
+}
+
+static unsigned fuzzInt(unsigned runs) {
+    unsigned valid = 0;
+    for (unsigned i = 0; i < runs; i++) {
+        std::string s = intCandidate();
+        long got = 0, expected = 0;
+        bool ok = FormBinder::parseInt(s.c_str(), got);
+        bool ref = referenceInt(s, expected);
+        if (ok != ref || (ok && got != expected)) {
+            printf("  parseInt('%s'): %d/%ld, Referenz %d/%ld\n", s.c_str(), ok, got, ref, expected);
+            TestSupport::failures()++;
+        }
+        if (ok) valid++;
+    }
+    return valid;
+}
+
+// ---- Wahrheitswerte ----
+
+static bool referenceBool(const std::string& s, bool& out) {
+    std::string lower;
+    for (char c : s) lower += (char)tolower((unsigned char)c);
+    if (lower == "1" || lower == "true" || lower == "on" || lower == "yes") { out = true; return true; }
+    if (lower == "0" || lower == "false" || lower == "off" || lower == "no") { out = false; return true; }
+    return false;
+}
+
+static unsigned fuzzBool(unsigned runs) {
+    static const char* const words[] = {"1", "0", "true", "false", "on", "off", "yes", "no", "TRUE", "Off", "YeS"};
+    unsigned valid = 0;
+    for (unsigned i = 0; i < runs; i++) {
+        std::string s = words[rng() % (sizeof(words) / sizeof(words[0]))];
+        if (rng() % 2) s = (rng() % 2) ? mutate(s, "01aefnorstuy ") : randomString("01aefnorstuyAEFNO ", 6);
+        bool got = false, expected = false;
+        bool ok = FormBinder::parseBool(s.c_str(), got);
+        bool ref = referenceBool(s, expected);
+        if (ok != ref || (ok && got != expected)) {
+            printf("  parseBool('%s'): %d, Referenz %d\n", s.c_str(), ok, ref);
+            TestSupport::failures()++;
+        }
+        if (ok) valid++;
+    }
+    return valid;
+}
+
+static void nullInputs() {
+    uint8_t ip[4];
+    long v;
+    bool b;
+    CHECK(!FormBinder::parseIPv4(nullptr, ip));
+    CHECK(!FormBinder::parseInt(nullptr, v));
+    CHECK(!FormBinder::parseBool(nullptr, b));
+    CHECK(!FormBinder::parseInt("", v));
+    CHECK(!FormBinder::parseInt("-", v));
+    CHECK(FormBinder::parseInt("-9223372036854775808", v) && v == LONG_MIN);
+}
+
+// Bisheriger Weg: sscanf für Adressen (ohne Bereichsprüfung), strtol für Zahlen
+static void benchmark() {
+    const unsigned n = 1000000;
+    volatile unsigned sink = 0;
+    uint8_t ip[4];
+    long v;
+    printf("Parser je Aufruf:\n");
+    printf("  parseIPv4              %6.1f ns\n", 1000 * TestSupport::measureUs(n, [&]() {
+        sink += FormBinder::parseIPv4("192.168.178.50", ip);
+    }));
+    printf("  sscanf(\"%%d.%%d.%%d.%%d\")  %6.1f ns\n", 1000 * TestSupport::measureUs(n, [&]() {
+        int a, b, c, d;
+        sink += sscanf("192.168.178.50", "%d.%d.%d.%d", &a, &b, &c, &d);
+    }));
+    printf("  parseInt               %6.1f ns\n", 1000 * TestSupport::measureUs(n, [&]() {
+        sink += FormBinder::parseInt("60000", v);
+    }));
+    printf("  strtol                 %6.1f ns\n", 1000 * TestSupport::measureUs(n, [&]() {
+        char* end;
+        sink += strtol("60000", &end, 10) > 0;
+    }));
+}
+
+int main(int argc, char** argv) {
+    unsigned seed = argValue(argc, argv, "--seed", 1);
+    unsigned runs = argValue(argc, argv, "--runs", 200000);
+    rng.seed(seed);
+
+    nullInputs();
+    unsigned ipValid = fuzzIPv4(runs);
+    unsigned intValid = fuzzInt(runs);
+    unsigned boolValid = fuzzBool(runs);
+    printf("  Seed %u, je %u Eingaben; gültig: IPv4 %u, int %u, bool %u\n", seed, runs, ipValid, intValid,
+           boolValid);
+    // Ohne genug gültige Fälle prüft der Vergleich fast nur die Ablehnung
+    CHECK(ipValid > runs / 10 && intValid > runs / 10 && boolValid > runs / 10);
+
+    if (TestSupport::benchRequested(argc, argv)) benchmark();
+    return TestSupport::finish("form_fuzz_test");
+}
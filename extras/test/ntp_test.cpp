@@ -0,0 +1,311 @@
+// SNTP-Client (WiFiWebManagerNtp) gegen lokale Stand-in-Server auf 127.0.0.1, in virtueller Zeit:
+// Ausfallwechsel, Stellen gegenüber Nachführen, Driftschätzung und Abfrageintervall.
+// Außerdem: Umkonfiguration aus Web-Handlern wird erst in loop() übernommen.
+
+#include <WiFiWebManager.h>
+#include <WiFiWebManagerNtp.h>
+#include <HostRuntime.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <math.h>
+#include <vector>
+
+#include "TestSupport.h"
+
+// "Echte" Zeit der Stand-in-Server: 2026-10-18 00:00 UTC plus virtuelle Laufzeit
+static const int64_t TRUE_EPOCH_US = 1792281600LL * 1000000;
+static const int64_t NTP_UNIX_OFFSET = 2208988800LL;
+
+static int64_t trueNowUs() {
+    return TRUE_EPOCH_US + (int64_t)HostRuntime::monotonicUs();
+}
+
+static int64_t localNowUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void putNtp(int64_t us, uint8_t* p) {
+    uint32_t seconds = (uint32_t)(us / 1000000 + NTP_UNIX_OFFSET);
+    uint32_t fraction = (uint32_t)(((uint64_t)(us % 1000000) << 32) / 1000000);
+    for (int i = 0; i < 4; i++) {
+        p[i] = seconds >> (24 - 8 * i);
+        p[4 + i] = fraction >> (24 - 8 * i);
+    }
+}
+
+// Stand-in für einen NTP-Server: antwortet (oder eben nicht) auf Anfragen im Client-Modus
+struct StandinServer {
+    enum class Mode { Normal, Silent, KissOfDeath, Unsynchronised };
+
+    int fd = -1;
+    uint16_t port = 0;
+    Mode mode;
+    int64_t errorUs = 0;        // Abweichung dieses Servers von der echten Zeit
+    unsigned requests = 0;
+    unsigned answers = 0;
+
+    explicit StandinServer(Mode m = Mode::Normal) : mode(m) {
+        fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+        socklen_t len = sizeof(addr);
+        getsockname(fd, (struct sockaddr*)&addr, &len);
+        port = ntohs(addr.sin_port);
+    }
+    ~StandinServer() { close(fd); }
+
+    String address() const { return "127.0.0.1:" + String(port); }
+
+    // Eine anstehende Anfrage beantworten; T2 jetzt, T3 0,2 ms später
+    void poll() {
+        uint8_t request[48];
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        while (recvfrom(fd, request, sizeof(request), MSG_DONTWAIT, (struct sockaddr*)&from, &fromLen) == 48) {
+            requests++;
+            if (mode == Mode::Silent || (request[0] & 0x07) != 3) continue;
+            uint8_t reply[48];
+            memset(reply, 0, sizeof(reply));
+            reply[0] = (mode == Mode::Unsynchronised ? 0xC0 : 0x00) | 0x20 | 4;   // LI, Version 4, Server
+            reply[1] = mode == Mode::KissOfDeath ? 0 : 2;
+            memcpy(reply + 24, request + 40, 8);
+            int64_t now = trueNowUs() + errorUs;
+            putNtp(now, reply + 32);
+            putNtp(now + 200, reply + 40);
+            sendto(fd, reply, sizeof(reply), 0, (struct sockaddr*)&from, fromLen);
+            answers++;
+        }
+    }
+};
+
+// Ein Schritt: Client sendet ggf., Server antwortet nach 1 ms Hinweg, Client empfängt nach
+// weiteren 1 ms (symmetrischer Pfad, der Offset ist also exakt messbar), dann Pause
+static void step(WiFiWebManagerNtp& ntp, std::vector<StandinServer*> servers, uint64_t idleUs = 250000) {
+    ntp.loop();
+    HostRuntime::advanceTime(1000);
+    for (StandinServer* server : servers) server->poll();
+    HostRuntime::advanceTime(1000);
+    ntp.loop();
+    HostRuntime::advanceTime(idleUs);
+}
+
+static void runFor(WiFiWebManagerNtp& ntp, std::vector<StandinServer*> servers, uint64_t seconds,
+                   std::function<void()> afterStep = nullptr) {
+    uint64_t end = HostRuntime::monotonicUs() + seconds * 1000000;
+    while (HostRuntime::monotonicUs() < end) {
+        step(ntp, servers);
+        if (afterStep) afterStep();
+    }
+}
+
+static void firstSyncSteps() {
+    StandinServer server;
+    WiFiWebManagerNtp ntp;
+    ntp.setServers(server.address());
+    CHECK(ntp.begin());
+    CHECK(localNowUs() < 1000000000LL);               // Uhr startet wie auf dem Gerät bei 1970
+    runFor(ntp, {&server}, 2);
+
+    const WiFiWebManagerNtp::Status& t = ntp.status();
+    CHECK(t.synced);
+    CHECK_EQ(t.syncCount, 1u);
+    CHECK_EQ(t.stepCount, 0u);                         // Erstes Stellen zählt nicht als Sprung
+    CHECK_EQ(t.stratum, 2);
+    CHECK(t.server == "127.0.0.1");
+    // Der Offset ist der ganze Sprung seit 1970 - passt nicht in 32 Bit
+    CHECK(llabs(t.offsetUs - TRUE_EPOCH_US) < 10000000LL);
+    CHECK(llabs(localNowUs() - trueNowUs()) < 1000);
+    CHECK_EQ(t.pollIntervalS, WiFiWebManagerNtp::MIN_POLL_S);
+}
+
+static void failover() {
+    StandinServer silent(StandinServer::Mode::Silent);
+    StandinServer kod(StandinServer::Mode::KissOfDeath);
+    StandinServer unsynced(StandinServer::Mode::Unsynchronised);
+    StandinServer good;
+    WiFiWebManagerNtp ntp;
+    ntp.setServers(silent.address() + ", " + kod.address() + "," + unsynced.address() + " , " + good.address());
+    ntp.begin();
+    runFor(ntp, {&silent, &kod, &unsynced, &good}, 10);
+
+    const WiFiWebManagerNtp::Status& t = ntp.status();
+    CHECK(t.synced);
+    CHECK_EQ(t.failCount, 3u);
+    CHECK(silent.requests == 1 && kod.requests == 1 && unsynced.requests == 1);
+    CHECK_EQ(good.answers, 1u);
+    CHECK(t.lastError[0] == '\0');
+
+    // Nur noch stumme Server: Fehler zählen, Status bleibt synchronisiert, Pause nach jeder Runde
+    ntp.setServers(silent.address());
+    unsigned before = silent.requests;
+    runFor(ntp, {&silent}, 3 * WiFiWebManagerNtp::MIN_POLL_S);
+    CHECK(silent.requests - before >= 2 && silent.requests - before <= 4);
+    CHECK(strlen(ntp.status().lastError) > 0);
+}
+
+static void slewVersusStep() {
+    StandinServer server;
+    WiFiWebManagerNtp ntp;
+    ntp.setServers(server.address());
+    ntp.begin();
+    runFor(ntp, {&server}, 2);
+    CHECK_EQ(ntp.status().syncCount, 1u);
+
+    // 50 ms Abweichung: nachführen, die Uhr läuft nie rückwärts
+    server.errorUs = 50000;
+    int64_t last = localNowUs();
+    bool monotonic = true;
+    uint32_t syncs = ntp.status().syncCount;
+    runFor(ntp, {&server}, WiFiWebManagerNtp::MIN_POLL_S + 1, [&]() {
+        int64_t now = localNowUs();
+        if (now < last) monotonic = false;
+        last = now;
+    });
+    CHECK_EQ(ntp.status().syncCount, syncs + 1);
+    CHECK_EQ(ntp.status().stepCount, 0u);
+    CHECK(llabs(ntp.status().offsetUs - 50000) < 1000);
+    CHECK(monotonic);
+    // adjtime() schwenkt mit 500 ppm ein: nach 100 s ist der Rest aufgeholt
+    runFor(ntp, {&server}, 100);
+    CHECK(llabs(localNowUs() - (trueNowUs() + server.errorUs)) < 1000);
+
+    // 5 s Abweichung: stellen, Intervall wieder auf das Minimum
+    runFor(ntp, {&server}, 3 * WiFiWebManagerNtp::MIN_POLL_S);
+    CHECK(ntp.status().pollIntervalS > WiFiWebManagerNtp::MIN_POLL_S);
+    server.errorUs += 5000000;
+    uint32_t steps = ntp.status().stepCount;
+    runFor(ntp, {&server}, ntp.status().pollIntervalS + 1);
+    CHECK_EQ(ntp.status().stepCount, steps + 1);
+    CHECK(llabs(ntp.status().offsetUs - 5000000) < 1000);
+    CHECK_EQ(ntp.status().pollIntervalS, WiFiWebManagerNtp::MIN_POLL_S);
+    CHECK(llabs(localNowUs() - (trueNowUs() + server.errorUs)) < 1000);
+}
+
+// Ohne Drift: Intervall verdoppelt sich nach je zwei stabilen Messungen bis 4096 s
+static void pollSchedule() {
+    StandinServer server;
+    WiFiWebManagerNtp ntp;
+    ntp.setServers(server.address());
+    ntp.begin();
+
+    std::vector<uint32_t> intervals;
+    std::vector<uint64_t> syncTimes;
+    uint32_t syncs = 0;
+    runFor(ntp, {&server}, 8 * 3600, [&]() {
+        if (ntp.status().syncCount != syncs) {
+            syncs = ntp.status().syncCount;
+            intervals.push_back(ntp.status().pollIntervalS);
+            syncTimes.push_back(HostRuntime::monotonicUs());
+        }
+    });
+
+    const std::vector<uint32_t> expected = {64, 64, 128, 128, 256, 256, 512, 512, 1024, 1024, 2048, 2048, 4096};
+    CHECK(intervals.size() >= expected.size());
+    for (size_t i = 0; i < expected.size() && i < intervals.size(); i++) {
+        if (intervals[i] != expected[i]) printf("  Abfrage %u: Intervall %u s, erwartet %u s\n", (unsigned)i + 1,
+                                                (unsigned)intervals[i], (unsigned)expected[i]);
+        CHECK_EQ(intervals[i], expected[i]);
+    }
+    for (size_t i = expected.size(); i < intervals.size(); i++) CHECK_EQ(intervals[i], WiFiWebManagerNtp::MAX_POLL_S);
+    // Tatsächlicher Abstand entspricht dem angekündigten Intervall (Schrittweite 252 ms)
+    for (size_t i = 1; i < syncTimes.size(); i++) {
+        double gapS = (syncTimes[i] - syncTimes[i - 1]) / 1e6;
+        CHECK(fabs(gapS - intervals[i - 1]) < 0.6);
+    }
+    CHECK_EQ(ntp.status().stepCount, 0u);
+
+    // syncNow() (z.B. nach Reconnect) fragt sofort
+    ntp.syncNow();
+    step(ntp, {&server});
+    CHECK_EQ(ntp.status().syncCount, syncs + 1);
+}
+
+// Quarz geht 25 ppm vor: Drift wird geschätzt, Intervall bleibt so kurz, dass der Fehler
+// zwischen zwei Abfragen unter 32 ms bleibt
+static void driftEstimate() {
+    HostRuntime::setClockDriftPpm(25);
+    StandinServer server;
+    WiFiWebManagerNtp ntp;
+    ntp.setServers(server.address());
+    ntp.begin();
+    // Nach dem ersten Sprung: Abstand zur echten Zeit unmittelbar vor jeder Abfrage
+    int64_t maxError = 0;
+    uint32_t syncs = 0;
+    runFor(ntp, {&server}, 12 * 3600, [&]() {
+        int64_t error = llabs(localNowUs() - trueNowUs());
+        if (ntp.status().syncCount >= 3 && error > maxError) maxError = error;
+        syncs = ntp.status().syncCount;
+    });
+
+    const WiFiWebManagerNtp::Status& t = ntp.status();
+    printf("  Drift 25 ppm: geschätzt %.2f ppm, Intervall %u s, max. Fehler %.1f ms, %u Abfragen\n", t.driftPpm,
+           (unsigned)t.pollIntervalS, maxError / 1000.0, (unsigned)syncs);
+    CHECK(fabsf(t.driftPpm - 25) < 2.5f);
+    CHECK(t.pollIntervalS >= WiFiWebManagerNtp::MIN_POLL_S && t.pollIntervalS <= 32000 / 25);
+    CHECK(maxError < 40000);
+    CHECK_EQ(t.stepCount, 0u);
+    HostRuntime::setClockDriftPpm(0);
+}
+
+class WiFiWebManagerTest {
+public:
+    // /ntp_save und /config/import laufen im async_tcp-Task: dort nur vormerken
+    static void webChangesApplyInLoop() {
+        StandinServer server;
+        WiFiWebManager m;
+        m.ntpEnable = true;
+        m.ntpServer = server.address();
+        m.requestNtpUpdate();
+        CHECK(!m.ntp.isRunning());
+        m.applyNtpUpdate();
+        CHECK(m.ntp.isRunning());
+
+        m.ntpEnable = false;
+        m.requestNtpUpdate();
+        CHECK(m.ntp.isRunning());
+        m.applyNtpUpdate();
+        CHECK(!m.ntp.isRunning());
+        m.applyNtpUpdate();   // nichts vorgemerkt
+        CHECK(!m.ntp.isRunning());
+    }
+
+    // getNtpStatus() ist die Kopie aus publishNtpStatus(), nicht der Zustand, den loop() gerade ändert
+    static void statusIsSnapshot() {
+        StandinServer server;
+        WiFiWebManager m;
+        m.ntpEnable = true;
+        m.ntpServer = server.address();
+        m.requestNtpUpdate();
+        m.applyNtpUpdate();
+        runFor(m.ntp, {&server}, 2);
+        CHECK(m.ntp.status().synced);
+        CHECK(!m.getNtpStatus().synced);
+
+        m.publishNtpStatus();
+        WiFiWebManagerNtp::Status t = m.getNtpStatus();
+        CHECK(t.synced);
+        CHECK_EQ(t.syncCount, 1u);
+        CHECK(t.server == "127.0.0.1");
+        m.ntp.stop();
+    }
+};
+
+int main() {
+    HostRuntime::useVirtualTime();
+    firstSyncSteps();
+    failover();
+    slewVersusStep();
+    pollSchedule();
+    driftEstimate();
+    WiFiWebManagerTest::webChangesApplyInLoop();
+    WiFiWebManagerTest::statusIsSnapshot();
+    return TestSupport::finish("ntp_test");
+}
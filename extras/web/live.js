@@ -0,0 +1,35 @@
+/* WiFiWebManager - Live-Fragmente
+ * Elemente mit data-live='<url>' werden alle data-refresh Millisekunden
+ * (Standard 5000) neu geladen. Der Inhalt wird nur ersetzt, wenn er sich
+ * geaendert hat. Dank ETag/no-cache antwortet der Server bei unveraendertem
+ * Inhalt mit 304. In einem Hintergrund-Tab wird nicht abgefragt.
+ */
+(function () {
+  function poll(el) {
+    var url = el.getAttribute('data-live');
+    var ms = parseInt(el.getAttribute('data-refresh'), 10) || 5000;
+    if (document.hidden) {
+      setTimeout(function () { poll(el); }, ms);
+      return;
+    }
+    fetch(url, { cache: 'no-cache' })
+      .then(function (r) { return r.ok ? r.text() : null; })
+      .then(function (t) {
+        if (t !== null && t !== el.innerHTML) {
+          el.innerHTML = t;
+        }
+      })
+      .catch(function () {})
+      .then(function () {
+        setTimeout(function () { poll(el); }, ms);
+      });
+  }
+
+  var els = document.querySelectorAll('[data-live]');
+  for (var i = 0; i < els.length; i++) {
+    (function (el) {
+      var ms = parseInt(el.getAttribute('data-refresh'), 10) || 5000;
+      setTimeout(function () { poll(el); }, ms);
+    })(els[i]);
+  }
+})();
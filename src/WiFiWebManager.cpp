@@ -1,4 +1,19 @@
 #include "WiFiWebManager.h"
+#include "WiFiWebManagerAssets.h"
+#include "WiFiWebManagerDns.h"
+#include "WiFiWebManagerGzip.h"
+#include "WiFiWebManagerVersion.h"
+#include "WiFiWebManagerSecret.h"
+#include <time.h>
+#include <lwip/sockets.h>
+#include <nvs.h>
+#include <esp_idf_version.h>
+#if ESP_IDF_VERSION_MAJOR >= 5
+#include <esp_app_desc.h>
+#else
+#include <esp_ota_ops.h>
+#define esp_app_get_description esp_ota_get_app_description
+#endif
 
 WiFiWebManager::WiFiWebManager() {
     // Reset-Button Pin als Input mit Pull-up konfigurieren
@@ -8,6 +23,7 @@ WiFiWebManager::WiFiWebManager() {
 void WiFiWebManager::begin() {
     debugPrintln("\n=== Starte WiFiWebManager ===");
     loadConfig();
+    registerWiFiEvents();
 
     // Prüfe Boot-Attempts und entscheide Verbindungsstrategie
     if (wifiBootAttempts >= MAX_BOOT_ATTEMPTS) {
@@ -38,12 +54,38 @@ void WiFiWebManager::begin() {
         startAP();
     }
     
-    handleNTP();
+    handleNTP(ntpEnable, ntpServer);
     setupWebServer();
+
+    // ArduinoOTA-Callbacks laufen in ArduinoOTA.handle(), also im loop()-Kontext -
+    // direkt zustellen, da ArduinoOTA nach onEnd() selbst neu startet
+    ArduinoOTA.onStart([this]() {
+        otaLastReported = 0;
+        publishEvent(WiFiWebManagerEvent::OtaStarted);
+        dispatchEvents();
+    });
+    ArduinoOTA.onProgress([this](unsigned int progress, unsigned int total) {
+        size_t percent = total > 0 ? (size_t)progress * 100 / total : 0;
+        if (percent / 10 != otaLastReported / 10) {
+            otaLastReported = percent;
+            publishEvent(WiFiWebManagerEvent::OtaProgress, percent);
+            dispatchEvents();
+        }
+    });
+    ArduinoOTA.onEnd([this]() {
+        publishEvent(WiFiWebManagerEvent::OtaDone);
+        dispatchEvents();
+    });
+    ArduinoOTA.onError([this](ota_error_t error) {
+        publishEvent(WiFiWebManagerEvent::OtaFailed, error);
+        dispatchEvents();
+    });
     ArduinoOTA.begin();
 }
 
 void WiFiWebManager::loop() {
+    dispatchEvents();
+
     if (shouldReboot) {
         debugPrintln("Reboot...");
         delay(500);
@@ -52,6 +94,18 @@ void WiFiWebManager::loop() {
     
     handleResetButton();
     ArduinoOTA.handle();
+    processDNS();
+    applyNtpUpdate();
+
+    // Jede neue IP - auch nach einem Reconnect, den der ESP32-Core selbst erledigt hat
+    if (gotIpPending.exchange(false) && WiFi.getMode() == WIFI_STA) {
+        ntp.syncNow();  // Nicht bis zum nächsten Intervall warten
+        startMDNS();
+    }
+    if (ntp.isRunning() && WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
+        ntp.loop();
+        publishNtpStatus();
+    }
     
     // Überwachung der WLAN-Verbindung (alle 30 Sekunden)
     static unsigned long lastWiFiCheck = 0;
@@ -91,12 +145,14 @@ void WiFiWebManager::handleResetButton() {
         
         if (pressTime >= WIFI_RESET_TIME && pressTime < FULL_RESET_TIME) {
             debugPrintln("Reset-Button 3-10 Sekunden gedrückt - Lösche WLAN-Daten!");
+            publishEvent(WiFiWebManagerEvent::ResetRequested, 0);
             clearWiFiConfig();
             debugPrintln("WLAN-Reset durchgeführt - Neustart...");
             delay(1000);
             shouldReboot = true;
         } else if (pressTime >= FULL_RESET_TIME) {
             debugPrintln("Reset-Button >10 Sekunden gedrückt - Werks-Reset!");
+            publishEvent(WiFiWebManagerEvent::ResetRequested, 1);
             clearAllConfig();
             debugPrintln("Werks-Reset durchgeführt - Neustart...");
             delay(1000);
@@ -110,18 +166,137 @@ void WiFiWebManager::handleResetButton() {
     lastResetButtonState = currentState;
 }
 
+// Netzwerk-Konfiguration als ein Datensatz mit CRC, abwechselnd in zwei Slots (A/B) geschrieben.
+// Ein abgebrochener Schreibvorgang trifft immer nur den älteren Slot - der letzte gültige Stand bleibt erhalten.
+//
+// Aufbau (Little Endian):
+//   magic u16 | version u8 | flags u8 | seq u32 | payloadLen u16 | crc32 u32 | payload
+//   payload: bootAttempts u8, danach ssid, pwd, hostname, ip, gateway, subnet, dns, ntpServer
+//            jeweils als Länge u8 + Bytes
+static const uint16_t CONFIG_MAGIC = 0x5757;
+static const uint8_t CONFIG_VERSION = 1;
+static const size_t CONFIG_HEADER_SIZE = 14;
+static const size_t CONFIG_RECORD_MAX = 512;
+static const char* const CONFIG_SLOT_KEYS[2] = {"cfgA", "cfgB"};
+static const uint8_t CONFIG_FLAG_STATIC_IP = 0x01;
+static const uint8_t CONFIG_FLAG_NTP = 0x02;
+// Altes Format: ein NVS-Key pro Feld. Ein WLAN-Reset entfernte nur ssid/bootAttempts, saveNtpConfig()
+// schrieb nur die NTP-Keys - deshalb gilt die Konfiguration als alt, sobald irgendeiner davon existiert.
+static const char* const LEGACY_CONFIG_KEYS[] = {"ssid", "pwd", "hostname", "useStaticIP", "ip", "gateway",
+                                                 "subnet", "dns", "ntpEnable", "ntpServer", "bootAttempts"};
+
+static bool putRecordString(uint8_t* buf, size_t& pos, const String& value) {
+    if (value.length() > 255 || pos + 1 + value.length() > CONFIG_RECORD_MAX) return false;
+    buf[pos++] = (uint8_t)value.length();
+    memcpy(buf + pos, value.c_str(), value.length());
+    pos += value.length();
+    return true;
+}
+
+static bool getRecordString(const uint8_t* buf, size_t& pos, size_t end, String& value) {
+    if (pos >= end) return false;
+    size_t len = buf[pos++];
+    if (pos + len > end) return false;
+    value = "";
+    value.concat((const char*)buf + pos, len);
+    pos += len;
+    return true;
+}
+
+static void putLE(uint8_t* buf, size_t pos, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) buf[pos + i] = (value >> (8 * i)) & 0xFF;
+}
+
+static uint32_t getLE(const uint8_t* buf, size_t pos, int bytes) {
+    uint32_t value = 0;
+    for (int i = 0; i < bytes; i++) value |= (uint32_t)buf[pos + i] << (8 * i);
+    return value;
+}
+
+bool WiFiWebManager::readConfigSlot(int slot, uint8_t* buf, uint32_t& seq, size_t& payloadLen) {
+    size_t len = prefs.getBytes(CONFIG_SLOT_KEYS[slot], buf, CONFIG_RECORD_MAX);
+    if (len < CONFIG_HEADER_SIZE) return false;
+    if (getLE(buf, 0, 2) != CONFIG_MAGIC || buf[2] != CONFIG_VERSION) return false;
+
+    payloadLen = getLE(buf, 8, 2);
+    if (CONFIG_HEADER_SIZE + payloadLen != len) return false;
+    uint32_t crc = WiFiWebManagerGzip::crc32(0, buf, 10);
+    crc = WiFiWebManagerGzip::crc32(crc, buf + CONFIG_HEADER_SIZE, payloadLen);
+    if (crc != getLE(buf, 10, 4)) {
+        debugPrintf("Konfiguration: CRC-Fehler in Slot %c\n", 'A' + slot);
+        return false;
+    }
+    seq = getLE(buf, 4, 4);
+    return true;
+}
+
 void WiFiWebManager::loadConfig() {
+    uint8_t buf[CONFIG_RECORD_MAX];
+    uint8_t other[CONFIG_RECORD_MAX];
+    uint32_t seqA = 0, seqB = 0;
+    size_t lenA = 0, lenB = 0;
+
     prefs.begin("netcfg", true);
-    
-    ssid = prefs.getString("ssid", "");
-    password = prefs.getString("pwd", "");
-    hostname = prefs.getString("hostname", "");
-    
+    bool validA = readConfigSlot(0, buf, seqA, lenA);
+    bool validB = readConfigSlot(1, other, seqB, lenB);
+    bool legacy = false;
+    if (!validA && !validB) {
+        for (const char* key : LEGACY_CONFIG_KEYS) {
+            if (prefs.isKey(key)) {
+                legacy = true;
+                break;
+            }
+        }
+    }
+    if (legacy) loadLegacyConfig();
+    prefs.end();
+
+    // Neuesten gültigen Slot wählen (Vergleich überlaufsicher)
+    bool useB = validB && (!validA || (int32_t)(seqB - seqA) > 0);
+    if (useB) memcpy(buf, other, CONFIG_HEADER_SIZE + lenB);
+
+    if (validA || validB) {
+        configSlot = useB ? 1 : 0;
+        configSeq = useB ? seqB : seqA;
+        size_t payloadLen = useB ? lenB : lenA;
+        size_t pos = CONFIG_HEADER_SIZE;
+        size_t end = CONFIG_HEADER_SIZE + payloadLen;
+        uint8_t flags = buf[3];
+        useStaticIP = flags & CONFIG_FLAG_STATIC_IP;
+        ntpEnable = flags & CONFIG_FLAG_NTP;
+        wifiBootAttempts = pos < end ? buf[pos++] : 0;
+        bool ok = getRecordString(buf, pos, end, ssid) && getRecordString(buf, pos, end, password) &&
+                  getRecordString(buf, pos, end, hostname) && getRecordString(buf, pos, end, ip) &&
+                  getRecordString(buf, pos, end, gateway) && getRecordString(buf, pos, end, subnet) &&
+                  getRecordString(buf, pos, end, dns) && getRecordString(buf, pos, end, ntpServer);
+        if (!ok) debugPrintln("Warnung: Konfigurationsdatensatz unvollständig!");
+        debugPrintf("Konfiguration geladen (Slot %c, #%u).\n", 'A' + configSlot, (unsigned)configSeq);
+    } else if (legacy) {
+        // Einmalige Migration vom alten Format (ein NVS-Key pro Feld)
+        debugPrintln("Migriere Konfiguration in das Datensatz-Format...");
+        saveConfig();
+        prefs.begin("netcfg", false);
+        for (const char* key : LEGACY_CONFIG_KEYS) prefs.remove(key);
+        prefs.end();
+    } else {
+        debugPrintln("Keine gespeicherte Konfiguration, verwende Standardwerte.");
+    }
+
     // Wenn kein Hostname gesetzt und Default vorhanden, verwende Default
     if (hostname.length() == 0 && defaultHostname.length() > 0) {
         hostname = defaultHostname;
     }
-    
+
+    if (ssid.length() > 0) {
+        debugPrintf("Gespeichertes WLAN: %s\n", ssid.c_str());
+    }
+    debugPrintf("Boot-Versuche: %d\n", wifiBootAttempts);
+}
+
+void WiFiWebManager::loadLegacyConfig() {
+    ssid = prefs.getString("ssid", "");
+    password = prefs.getString("pwd", "");
+    hostname = prefs.getString("hostname", "");
     useStaticIP = prefs.getBool("useStaticIP", false);
     ip = prefs.getString("ip", "");
     gateway = prefs.getString("gateway", "");
@@ -130,55 +305,61 @@ void WiFiWebManager::loadConfig() {
     ntpEnable = prefs.getBool("ntpEnable", false);
     ntpServer = prefs.getString("ntpServer", "pool.ntp.org");
     wifiBootAttempts = prefs.getInt("bootAttempts", 0);
-    
-    prefs.end();
-    debugPrintln("Konfiguration geladen.");
-    
-    if (ssid.length() > 0) {
-        debugPrintf("Gespeichertes WLAN: %s\n", ssid.c_str());
-    }
-    debugPrintf("Boot-Versuche: %d\n", wifiBootAttempts);
 }
 
-void WiFiWebManager::saveConfig() {
+bool WiFiWebManager::saveConfig() {
+    uint8_t buf[CONFIG_RECORD_MAX];
+    size_t pos = CONFIG_HEADER_SIZE;
+    buf[pos++] = (uint8_t)(wifiBootAttempts < 0 ? 0 : (wifiBootAttempts > 255 ? 255 : wifiBootAttempts));
+    bool ok = putRecordString(buf, pos, ssid) && putRecordString(buf, pos, password) &&
+              putRecordString(buf, pos, hostname) && putRecordString(buf, pos, ip) &&
+              putRecordString(buf, pos, gateway) && putRecordString(buf, pos, subnet) &&
+              putRecordString(buf, pos, dns) && putRecordString(buf, pos, ntpServer);
+    if (!ok) {
+        debugPrintln("Fehler: Konfiguration zu groß, nicht gespeichert!");
+        return false;
+    }
+
+    uint32_t seq = configSeq + 1;
+    uint8_t flags = (useStaticIP ? CONFIG_FLAG_STATIC_IP : 0) | (ntpEnable ? CONFIG_FLAG_NTP : 0);
+    putLE(buf, 0, CONFIG_MAGIC, 2);
+    buf[2] = CONFIG_VERSION;
+    buf[3] = flags;
+    putLE(buf, 4, seq, 4);
+    putLE(buf, 8, pos - CONFIG_HEADER_SIZE, 2);
+    uint32_t crc = WiFiWebManagerGzip::crc32(0, buf, 10);
+    crc = WiFiWebManagerGzip::crc32(crc, buf + CONFIG_HEADER_SIZE, pos - CONFIG_HEADER_SIZE);
+    putLE(buf, 10, crc, 4);
+
+    // Immer in den Slot schreiben, der NICHT den aktuellen Stand enthält
+    int slot = configSlot ^ 1;
     prefs.begin("netcfg", false);
-    prefs.putString("ssid", ssid);
-    prefs.putString("pwd", password);
-    prefs.putString("hostname", hostname);
-    prefs.putBool("useStaticIP", useStaticIP);
-    prefs.putString("ip", ip);
-    prefs.putString("gateway", gateway);
-    prefs.putString("subnet", subnet);
-    prefs.putString("dns", dns);
-    prefs.putBool("ntpEnable", ntpEnable);
-    prefs.putString("ntpServer", ntpServer);
-    prefs.putInt("bootAttempts", wifiBootAttempts);
+    size_t written = prefs.putBytes(CONFIG_SLOT_KEYS[slot], buf, pos);
     prefs.end();
-    debugPrintln("Konfiguration gespeichert.");
+
+    if (written == pos) {
+        configSlot = slot;
+        configSeq = seq;
+        publishEvent(WiFiWebManagerEvent::ConfigSaved, seq);
+        debugPrintf("Konfiguration gespeichert (Slot %c, #%u).\n", 'A' + slot, (unsigned)seq);
+        return true;
+    }
+    debugPrintln("Fehler: Konfiguration konnte nicht gespeichert werden!");
+    return false;
 }
 
 void WiFiWebManager::saveNtpConfig(bool ntpEn, const String& ntpSrv) {
-    prefs.begin("netcfg", false);
-    prefs.putBool("ntpEnable", ntpEn);
-    prefs.putString("ntpServer", ntpSrv);
-    prefs.end();
     ntpEnable = ntpEn;
     ntpServer = ntpSrv;
-    handleNTP();
+    saveConfig();
+    requestNtpUpdate();
 }
 
 void WiFiWebManager::clearWiFiConfig() {
-    // WICHTIG: Zuerst lokale Variablen löschen für sauberen Zustand
     ssid = "";
     password = "";
     wifiBootAttempts = 0;
-    
-    // Dann aus Preferences löschen
-    prefs.begin("netcfg", false);
-    prefs.remove("ssid");
-    prefs.remove("pwd");
-    prefs.remove("bootAttempts");
-    prefs.end();
+    saveConfig();
     
     debugPrintln("WLAN-Konfiguration gelöscht!");
 }
@@ -196,6 +377,8 @@ void WiFiWebManager::clearAllConfig() {
     ntpEnable = false;
     ntpServer = "pool.ntp.org";
     wifiBootAttempts = 0;
+    configSeq = 0;
+    configSlot = 1;
     
     // Dann alle Preferences löschen
     prefs.begin("netcfg", false);
@@ -211,27 +394,26 @@ void WiFiWebManager::clearAllConfig() {
 }
 
 void WiFiWebManager::reset() {
+    publishEvent(WiFiWebManagerEvent::ResetRequested, 1);
     clearAllConfig();
     shouldReboot = true;
 }
 
 void WiFiWebManager::resetBootAttempts() {
+    if (wifiBootAttempts == 0) return; // Kein unnötiger Flash-Schreibvorgang
     wifiBootAttempts = 0;
-    prefs.begin("netcfg", false);
-    prefs.putInt("bootAttempts", 0);
-    prefs.end();
+    saveConfig();
 }
 
 void WiFiWebManager::incrementBootAttempts() {
     wifiBootAttempts++;
-    prefs.begin("netcfg", false);
-    prefs.putInt("bootAttempts", wifiBootAttempts);
-    prefs.end();
+    saveConfig();
 }
 
 bool WiFiWebManager::connectToStoredWiFi() {
     if (ssid.length() == 0) return false;
     
+    stopDNS();
     WiFi.mode(WIFI_STA);
 
     if (hostname.length() > 0) {
@@ -271,10 +453,71 @@ bool WiFiWebManager::connectToStoredWiFi() {
 }
 
 void WiFiWebManager::startAP() {
+    stopMDNS();
     WiFi.mode(WIFI_AP);
     WiFi.softAP("ESP32_SETUP");
     debugPrintln("Access Point gestartet: ESP32_SETUP");
     debugPrintln("AP-IP: 192.168.4.1");
+    startDNS();
+    publishEvent(WiFiWebManagerEvent::APFallback, wifiBootAttempts);
+}
+
+void WiFiWebManager::startDNS() {
+    if (dnsSocket >= 0) return;
+
+    dnsSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (dnsSocket < 0) {
+        debugPrintln("Fehler: DNS-Socket konnte nicht angelegt werden!");
+        return;
+    }
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(DNS_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(dnsSocket, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        debugPrintln("Fehler: DNS-Port 53 belegt!");
+        close(dnsSocket);
+        dnsSocket = -1;
+        return;
+    }
+    debugPrintln("Captive-Portal DNS gestartet.");
+}
+
+void WiFiWebManager::stopDNS() {
+    if (dnsSocket < 0) return;
+    close(dnsSocket);
+    dnsSocket = -1;
+    debugPrintln("Captive-Portal DNS gestoppt.");
+}
+
+void WiFiWebManager::processDNS() {
+    if (dnsSocket < 0) return;
+
+    IPAddress apIP = WiFi.softAPIP();
+    const uint8_t ip[4] = {apIP[0], apIP[1], apIP[2], apIP[3]};
+
+    // Max. 4 Anfragen pro loop(), damit der Rest der Schleife nicht verhungert
+    for (int i = 0; i < 4; i++) {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int len = recvfrom(dnsSocket, dnsBuffer, sizeof(dnsBuffer), MSG_DONTWAIT, (struct sockaddr*)&from, &fromLen);
+        if (len <= 0) break;
+
+        size_t responseLen = WiFiWebManagerDns::buildResponse(dnsBuffer, len, sizeof(dnsBuffer), ip);
+        if (responseLen > 0) {
+            sendto(dnsSocket, dnsBuffer, responseLen, 0, (struct sockaddr*)&from, fromLen);
+        }
+    }
+}
+
+void WiFiWebManager::handleCaptiveProbe(AsyncWebServerRequest *request) {
+    if (WiFi.getMode() == WIFI_AP) {
+        // Keine "Erfolg"-Antwort: das Betriebssystem erkennt so das Captive Portal und öffnet die Setup-Seite
+        request->redirect("http://" + WiFi.softAPIP().toString() + "/wlan");
+    } else {
+        request->send(404, "text/plain", "Not found");
+    }
 }
 
 String WiFiWebManager::getAvailableSSIDs() {
@@ -292,20 +535,64 @@ String WiFiWebManager::getAvailableSSIDs() {
 }
 
 bool WiFiWebManager::parseIPString(const String& str, IPAddress& out) {
-    int parts[4];
-    if (sscanf(str.c_str(), "%d.%d.%d.%d", &parts[0], &parts[1], &parts[2], &parts[3]) == 4) {
-        out = IPAddress(parts[0], parts[1], parts[2], parts[3]);
-        return true;
+    uint8_t octets[4];
+    if (!FormBinder::parseIPv4(str.c_str(), octets)) return false;
+    out = IPAddress(octets[0], octets[1], octets[2], octets[3]);
+    return true;
+}
+
+void WiFiWebManager::handleNTP(bool enable, const String& servers) {
+    // Eigener SNTP-Client statt configTime(): nur so sind Offset, Laufzeit und Drift messbar
+    if (enable) {
+        ntp.setServers(servers);
+        if (ntp.begin()) {
+            debugPrint("NTP aktiviert, Server: ");
+            debugPrintln(servers);
+        } else {
+            debugPrintln("Fehler: NTP-Socket konnte nicht angelegt werden!");
+        }
+    } else {
+        ntp.stop();
     }
-    return false;
+    publishNtpStatus();
 }
 
-void WiFiWebManager::handleNTP() {
-    if (ntpEnable) {
-        configTime(0, 0, ntpServer.c_str());
-        debugPrint("NTP aktiviert, Server: ");
-        debugPrintln(ntpServer);
+void WiFiWebManager::requestNtpUpdate() {
+    std::lock_guard<std::mutex> guard(ntpLock);
+    ntpPendingEnable = ntpEnable;
+    ntpPendingServer = ntpServer;
+    ntpUpdatePending = true;
+}
+
+void WiFiWebManager::applyNtpUpdate() {
+    bool enable;
+    String servers;
+    {
+        std::lock_guard<std::mutex> guard(ntpLock);
+        if (!ntpUpdatePending) return;
+        ntpUpdatePending = false;
+        enable = ntpPendingEnable;
+        servers = ntpPendingServer;
     }
+    handleNTP(enable, servers);
+}
+
+void WiFiWebManager::publishNtpStatus() {
+    // Nur nach einer Abfrage oder Umkonfiguration kopieren, nicht bei jedem loop()
+    const WiFiWebManagerNtp::Status& t = ntp.status();
+    std::lock_guard<std::mutex> guard(ntpLock);
+    if (t.syncCount == ntpStatusCopy.syncCount && t.failCount == ntpStatusCopy.failCount &&
+        t.lastError == ntpStatusCopy.lastError) return;
+    ntpStatusCopy = t;
+}
+
+WiFiWebManagerNtp::Status WiFiWebManager::ntpStatusSnapshot() const {
+    std::lock_guard<std::mutex> guard(ntpLock);
+    return ntpStatusCopy;
+}
+
+WiFiWebManagerNtp::Status WiFiWebManager::getNtpStatus() const {
+    return ntpStatusSnapshot();
 }
 
 // Debug-Modus Management
@@ -338,11 +625,85 @@ void WiFiWebManager::debugPrintln() {
 
 void WiFiWebManager::debugPrintf(const char* format, ...) {
     if (debugMode) {
+        // va_list kann nicht an Serial.printf() weitergereicht werden - erst formatieren
+        char buf[128];
         va_list args;
         va_start(args, format);
-        Serial.printf(format, args);
+        int len = vsnprintf(buf, sizeof(buf), format, args);
         va_end(args);
+        if (len < 0) return;
+        if ((size_t)len < sizeof(buf)) {
+            Serial.print(buf);
+            return;
+        }
+        char* longBuf = (char*)malloc(len + 1);
+        if (!longBuf) return;
+        va_start(args, format);
+        vsnprintf(longBuf, len + 1, format, args);
+        va_end(args);
+        Serial.print(longBuf);
+        free(longBuf);
+    }
+}
+
+// Ereignisse
+void WiFiWebManager::publishEvent(WiFiWebManagerEvent type, int32_t value) {
+    if (!events.push({type, value, (uint32_t)millis()})) {
+        debugPrintf("Warnung: Ereignis-Queue voll, %s verworfen\n", getEventName(type));
+    }
+}
+
+// Connected/Disconnected kommen direkt aus dem WLAN-Task: sofort und nur beim Zustandswechsel,
+// Wiederholungen (z.B. DISCONNECTED bei jedem Reconnect-Versuch) fallen weg.
+// mDNS und NTP werden dagegen in loop() neu gestartet, nicht im WLAN-Task.
+void WiFiWebManager::registerWiFiEvents() {
+    if (wifiEventsRegistered) return;
+    wifiEventsRegistered = true;
+    WiFi.onEvent([this](WiFiEvent_t, WiFiEventInfo_t) {
+        gotIpPending = true;
+        if (!linkUp.exchange(true)) publishEvent(WiFiWebManagerEvent::Connected, WiFi.RSSI());
+    }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent([this](WiFiEvent_t, WiFiEventInfo_t) {
+        if (linkUp.exchange(false)) publishEvent(WiFiWebManagerEvent::Disconnected);
+    }, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+void WiFiWebManager::dispatchEvents() {
+    // Ohne Callbacks bleiben die Ereignisse für pollEvent() in der Queue
+    if (eventCallbacks.empty()) return;
+    WiFiWebManagerEventData event;
+    while (events.pop(event)) {
+        for (const auto& callback : eventCallbacks) {
+            callback(event);
+        }
+    }
+}
+
+void WiFiWebManager::onEvent(EventCallback callback) {
+    eventCallbacks.push_back(callback);
+}
+
+bool WiFiWebManager::pollEvent(WiFiWebManagerEventData& event) {
+    return events.pop(event);
+}
+
+uint32_t WiFiWebManager::getDroppedEvents() const {
+    return events.overflows();
+}
+
+const char* WiFiWebManager::getEventName(WiFiWebManagerEvent type) {
+    switch (type) {
+        case WiFiWebManagerEvent::Connected:      return "Connected";
+        case WiFiWebManagerEvent::Disconnected:   return "Disconnected";
+        case WiFiWebManagerEvent::APFallback:     return "APFallback";
+        case WiFiWebManagerEvent::ConfigSaved:    return "ConfigSaved";
+        case WiFiWebManagerEvent::OtaStarted:     return "OtaStarted";
+        case WiFiWebManagerEvent::OtaProgress:    return "OtaProgress";
+        case WiFiWebManagerEvent::OtaDone:        return "OtaDone";
+        case WiFiWebManagerEvent::OtaFailed:      return "OtaFailed";
+        case WiFiWebManagerEvent::ResetRequested: return "ResetRequested";
     }
+    return "Unknown";
 }
 
 // Hostname-Management
@@ -351,6 +712,7 @@ void WiFiWebManager::setDefaultHostname(const String& hostname) {
     // Wenn aktueller Hostname leer ist, verwende den Default
     if (this->hostname.length() == 0) {
         this->hostname = hostname;
+        if (mdnsRunning) startMDNS();
     }
 }
 
@@ -358,6 +720,51 @@ String WiFiWebManager::getHostname() {
     return hostname.length() > 0 ? hostname : defaultHostname;
 }
 
+void WiFiWebManager::setMDNS(bool enabled) {
+    mdnsEnabled = enabled;
+    if (!enabled) {
+        stopMDNS();
+    } else if (WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
+        startMDNS();
+    }
+}
+
+// Version und Build-Zeitpunkt des Anwendungs-Images. __DATE__/__TIME__ hier wären der Zeitpunkt,
+// zu dem diese Bibliotheksdatei übersetzt wurde - die Arduino-IDE hält sie über Sketch-Builds hinweg vor.
+static String firmwareBuild() {
+    const esp_app_desc_t* app = esp_app_get_description();
+    return String(app->version) + " " + app->date + " " + app->time;
+}
+
+void WiFiWebManager::startMDNS() {
+    if (!mdnsEnabled) return;
+    // Neu starten statt nur ergänzen: so werden Hostname und TXT-Records sicher neu angekündigt
+    stopMDNS();
+    String name = getHostname();
+    if (name.length() == 0) name = WiFi.getHostname();
+    if (!MDNS.begin(name.c_str())) {
+        debugPrintln("Fehler: mDNS konnte nicht gestartet werden!");
+        return;
+    }
+    mdnsRunning = true;
+    MDNS.setInstanceName(name);
+    MDNS.addService("http", "tcp", 80);
+
+    // Geräteerkennung für Tools: eine Multicast-Anfrage statt Subnetz-Scan
+    MDNS.addService("wifiwebmanager", "tcp", 80);
+    MDNS.addServiceTxt("wifiwebmanager", "tcp", "version", WiFiWebManagerInfo::getVersion());
+    MDNS.addServiceTxt("wifiwebmanager", "tcp", "fw", firmwareBuild());
+    MDNS.addServiceTxt("wifiwebmanager", "tcp", "metrics", "/api/status");
+    MDNS.addServiceTxt("wifiwebmanager", "tcp", "config", "/config/export");
+    debugPrintf("mDNS gestartet: %s.local\n", name.c_str());
+}
+
+void WiFiWebManager::stopMDNS() {
+    if (!mdnsRunning) return;
+    MDNS.end();
+    mdnsRunning = false;
+}
+
 // Erweiterte Custom Data API
 void WiFiWebManager::saveCustomData(const String& key, const String& value) {
     if (isReservedKey(key)) {
@@ -435,16 +842,443 @@ void WiFiWebManager::removeCustomData(const String& key) {
     prefs.end();
 }
 
+// Ruft fn für jeden Eintrag eines NVS-Namespaces auf (API unterscheidet sich zwischen IDF 4 und 5)
+static void forEachNvsEntry(const char* ns, const std::function<void(const nvs_entry_info_t&)>& fn) {
+    nvs_entry_info_t info;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    nvs_iterator_t it = nullptr;
+    esp_err_t err = nvs_entry_find(NVS_DEFAULT_PART_NAME, ns, NVS_TYPE_ANY, &it);
+    while (err == ESP_OK) {
+        nvs_entry_info(it, &info);
+        fn(info);
+        err = nvs_entry_next(&it);
+    }
+    nvs_release_iterator(it);
+#else
+    nvs_iterator_t it = nvs_entry_find(NVS_DEFAULT_PART_NAME, ns, NVS_TYPE_ANY);
+    while (it != nullptr) {
+        nvs_entry_info(it, &info);
+        fn(info);
+        it = nvs_entry_next(it);
+    }
+#endif
+}
+
 std::vector<String> WiFiWebManager::getCustomDataKeys() {
     std::vector<String> keys;
+    forEachNvsEntry("cdata", [&keys](const nvs_entry_info_t& info) {
+        if (strncmp(info.key, "c_", 2) == 0) keys.push_back(String(info.key + 2));
+    });
+    return keys;
+}
+
+void WiFiWebManager::setCustomDataSecret(const String& key) {
+    for (const auto& k : secretCustomKeys) {
+        if (k == key) return;
+    }
+    secretCustomKeys.push_back(key);
+}
+
+// Konfigurations-Export: eine Zeile pro Wert, "name=wert" (Prozent-kodiert) bzw.
+// "name!=hex" für verschlüsselte Werte. Custom Data als "c:<typ>:<key>" mit Typ s/i/b/f.
+//
+//   [wwm-config v1]
+//   kdf=<salt>            (nur mit Passphrase)
+//   ssid=MeinWLAN
+//   pwd!=5f1c...
+//   c:i:interval=5000
+static const char* const CONFIG_EXPORT_HEADER = "[wwm-config v1]";
+
+static String escapeConfigValue(const String& value) {
+    String out;
+    out.reserve(value.length());
+    for (unsigned int i = 0; i < value.length(); i++) {
+        uint8_t c = value[i];
+        if (c < 0x20 || c == 0x7F || c == '%') {
+            char buf[4];
+            snprintf(buf, sizeof(buf), "%%%02X", c);
+            out += buf;
+        } else {
+            out += (char)c;
+        }
+    }
+    return out;
+}
+
+static bool unescapeConfigValue(const String& raw, String& value) {
+    value = "";
+    value.reserve(raw.length());
+    for (unsigned int i = 0; i < raw.length(); i++) {
+        if (raw[i] != '%') {
+            value += raw[i];
+            continue;
+        }
+        uint8_t c;
+        if (i + 2 >= raw.length() || !WiFiWebManagerSecret::fromHex(raw.c_str() + i + 1, 2, &c)) return false;
+        value += (char)c;
+        i += 2;
+    }
+    return true;
+}
+
+String WiFiWebManager::exportConfig(const String& passphrase) {
+    bool encrypt = passphrase.length() > 0;
+    uint8_t key[WiFiWebManagerSecret::KEY_SIZE];
+
+    String out = String(CONFIG_EXPORT_HEADER) + "\n";
+    out += "# " + getHostname() + ", WiFiWebManager " + WiFiWebManagerInfo::getVersion() + "\n";
+    if (encrypt) {
+        uint8_t salt[WiFiWebManagerSecret::SALT_SIZE];
+        WiFiWebManagerSecret::randomBytes(salt, sizeof(salt));
+        if (!WiFiWebManagerSecret::deriveKey(passphrase, salt, sizeof(salt), key)) return String();
+        out += "kdf=" + WiFiWebManagerSecret::toHex(salt, sizeof(salt)) + "\n";
+    }
+
+    auto addLine = [&](const String& name, const String& value, bool secret) {
+        if (!secret) {
+            out += name + "=" + escapeConfigValue(value) + "\n";
+        } else if (encrypt) {
+            out += name + "!=" + WiFiWebManagerSecret::seal(key, name, value) + "\n";
+        }
+        // Geheimnisse ohne Passphrase: Zeile entfällt, beim Import bleibt der Wert unverändert
+    };
+
+    addLine("ssid", ssid, false);
+    addLine("pwd", password, true);
+    addLine("hostname", hostname, false);
+    addLine("useStaticIP", useStaticIP ? "1" : "0", false);
+    addLine("ip", ip, false);
+    addLine("gateway", gateway, false);
+    addLine("subnet", subnet, false);
+    addLine("dns", dns, false);
+    addLine("ntpEnable", ntpEnable ? "1" : "0", false);
+    addLine("ntpServer", ntpServer, false);
+
+    // Custom Data: Typ aus dem NVS-Eintrag (Preferences speichert float als 4-Byte-Blob)
+    std::vector<std::pair<String, nvs_type_t>> entries;
+    forEachNvsEntry("cdata", [&entries](const nvs_entry_info_t& info) {
+        if (strncmp(info.key, "c_", 2) == 0) entries.push_back({String(info.key), info.type});
+    });
     prefs.begin("cdata", true);
-    
-    // ESP32 Preferences bietet keine direkte Möglichkeit, alle Schlüssel aufzulisten
-    // Diese Funktion ist eine Placeholder-Implementierung
-    // In der Praxis müsste man die Schlüssel separat verwalten
-    
+    for (const auto& entry : entries) {
+        String key = entry.first.substring(2);
+        bool secret = false;
+        for (const auto& k : secretCustomKeys) {
+            if (k == key) secret = true;
+        }
+        const char* nvsKey = entry.first.c_str();
+        switch (entry.second) {
+            case NVS_TYPE_STR:
+                addLine("c:s:" + key, prefs.getString(nvsKey), secret);
+                break;
+            case NVS_TYPE_I32:
+                addLine("c:i:" + key, String(prefs.getInt(nvsKey)), secret);
+                break;
+            case NVS_TYPE_U8:
+                addLine("c:b:" + key, prefs.getBool(nvsKey) ? "1" : "0", secret);
+                break;
+            case NVS_TYPE_BLOB:
+                if (prefs.getBytesLength(nvsKey) == sizeof(float)) {
+                    char buf[20];
+                    snprintf(buf, sizeof(buf), "%.9g", prefs.getFloat(nvsKey));   // 9 Stellen: exakt rücklesbar
+                    addLine("c:f:" + key, buf, secret);
+                }
+                break;
+            default:
+                break;
+        }
+    }
     prefs.end();
-    return keys;
+    return out;
+}
+
+bool WiFiWebManager::importConfig(const String& text, const String& passphrase, String& error, bool replaceCustomData) {
+    struct CustomValue {
+        String key;
+        char type;
+        String value;
+    };
+
+    // Erst alles prüfen, dann schreiben: eine fehlerhafte Datei ändert nichts
+    String newSSID = ssid, newPWD = password, newHostname = hostname;
+    String newIP = ip, newGateway = gateway, newSubnet = subnet, newDNS = dns, newNtpServer = ntpServer;
+    bool newUseStaticIP = useStaticIP, newNtpEnable = ntpEnable;
+    std::vector<CustomValue> custom;
+    uint8_t key[WiFiWebManagerSecret::KEY_SIZE];
+    bool haveKey = false;
+
+    int lineNo = 0;
+    unsigned int pos = 0;
+    while (pos < text.length()) {
+        int end = text.indexOf('\n', pos);
+        if (end < 0) end = text.length();
+        String line = text.substring(pos, end);
+        pos = end + 1;
+        lineNo++;
+        if (line.endsWith("\r")) line.remove(line.length() - 1);
+
+        if (lineNo == 1) {
+            if (line != CONFIG_EXPORT_HEADER) {
+                error = "Unbekanntes Format (erwartet " + String(CONFIG_EXPORT_HEADER) + ")";
+                return false;
+            }
+            continue;
+        }
+        if (line.length() == 0 || line[0] == '#') continue;
+
+        String where = "Zeile " + String(lineNo) + ": ";
+        int eq = line.indexOf('=');
+        if (eq <= 0) {
+            error = where + "'=' fehlt";
+            return false;
+        }
+        String name = line.substring(0, eq);
+        String raw = line.substring(eq + 1);
+        String value;
+
+        if (name == "kdf") {
+            uint8_t salt[WiFiWebManagerSecret::SALT_SIZE];
+            if (raw.length() != 2 * sizeof(salt) || !WiFiWebManagerSecret::fromHex(raw.c_str(), raw.length(), salt)) {
+                error = where + "ungültiger Salt";
+                return false;
+            }
+            if (passphrase.length() == 0) {
+                error = "Datei enthält verschlüsselte Werte - Passphrase erforderlich";
+                return false;
+            }
+            if (!WiFiWebManagerSecret::deriveKey(passphrase, salt, sizeof(salt), key)) {
+                error = "Schlüsselableitung fehlgeschlagen";
+                return false;
+            }
+            haveKey = true;
+            continue;
+        }
+
+        if (name.endsWith("!")) {
+            name.remove(name.length() - 1);
+            if (!haveKey) {
+                error = where + "verschlüsselter Wert ohne kdf-Zeile";
+                return false;
+            }
+            if (!WiFiWebManagerSecret::open(key, name, raw, value)) {
+                error = where + "Entschlüsselung fehlgeschlagen (falsche Passphrase?)";
+                return false;
+            }
+        } else if (!unescapeConfigValue(raw, value)) {
+            error = where + "ungültige %-Kodierung";
+            return false;
+        }
+
+        uint8_t octets[4];
+        bool boolValue;
+        long longValue;
+        struct TextField { const char* name; String* target; size_t maxLength; };
+        const TextField textFields[] = {
+            {"ssid", &newSSID, 32}, {"pwd", &newPWD, 64}, {"hostname", &newHostname, 63}, {"ntpServer", &newNtpServer, 128}
+        };
+        struct IPField { const char* name; String* target; };
+        const IPField ipFields[] = {{"ip", &newIP}, {"gateway", &newGateway}, {"subnet", &newSubnet}, {"dns", &newDNS}};
+
+        bool known = false;
+        for (const auto& f : textFields) {
+            if (name != f.name) continue;
+            if (value.length() > f.maxLength) {
+                error = where + name + " ist zu lang (max. " + String((unsigned long)f.maxLength) + " Zeichen)";
+                return false;
+            }
+            *f.target = value;
+            known = true;
+        }
+        for (const auto& f : ipFields) {
+            if (name != f.name) continue;
+            if (value.length() > 0 && !FormBinder::parseIPv4(value.c_str(), octets)) {
+                error = where + "ungültige IP-Adresse";
+                return false;
+            }
+            *f.target = value;
+            known = true;
+        }
+        if (name == "useStaticIP" || name == "ntpEnable") {
+            if (!FormBinder::parseBool(value.c_str(), boolValue)) {
+                error = where + "ungültiger Wahrheitswert";
+                return false;
+            }
+            (name == "useStaticIP" ? newUseStaticIP : newNtpEnable) = boolValue;
+            known = true;
+        }
+        if (name.startsWith("c:") && name.length() > 4 && name[3] == ':') {
+            char type = name[2];
+            String customKey = name.substring(4);
+            if (customKey.length() > 13) {   // NVS erlaubt 15 Zeichen, davon 2 für "c_"
+                error = where + "Schlüssel zu lang (max. 13 Zeichen)";
+                return false;
+            }
+            bool valid = (type == 's' && value.length() < 4000) ||
+                         (type == 'i' && FormBinder::parseInt(value.c_str(), longValue) && longValue >= INT32_MIN && longValue <= INT32_MAX) ||
+                         (type == 'b' && FormBinder::parseBool(value.c_str(), boolValue));
+            if (type == 'f') {
+                char* endPtr = nullptr;
+                strtof(value.c_str(), &endPtr);
+                valid = value.length() > 0 && *endPtr == '\0';
+            }
+            if (!valid) {
+                error = where + "ungültiger Wert für Typ '" + String(type) + "'";
+                return false;
+            }
+            custom.push_back({customKey, type, value});
+            known = true;
+        }
+        if (!known) {
+            error = where + "unbekannter Schlüssel '" + name + "'";
+            return false;
+        }
+    }
+    if (lineNo == 0) {
+        error = "Leere Datei";
+        return false;
+    }
+    if (newUseStaticIP && (newIP.length() == 0 || newGateway.length() == 0 || newSubnet.length() == 0 || newDNS.length() == 0)) {
+        error = "Statische IP benötigt IP-Adresse, Gateway, Subnetz und DNS";
+        return false;
+    }
+
+    // Custom Data: ein Handle, ein Commit (statt Öffnen/Commit pro Wert wie bei Preferences)
+    if (!custom.empty() || replaceCustomData) {
+        nvs_handle_t handle;
+        esp_err_t err = nvs_open("cdata", NVS_READWRITE, &handle);
+        if (err != ESP_OK) {
+            error = "NVS nicht verfügbar (" + String(esp_err_to_name(err)) + ")";
+            return false;
+        }
+        if (replaceCustomData) err = nvs_erase_all(handle);
+        for (size_t i = 0; i < custom.size() && err == ESP_OK; i++) {
+            const CustomValue& c = custom[i];
+            String nvsKey = "c_" + c.key;
+            bool b = false;
+            long l = 0;
+            float f = 0;
+            switch (c.type) {
+                case 's':
+                    err = nvs_set_str(handle, nvsKey.c_str(), c.value.c_str());
+                    break;
+                case 'i':
+                    FormBinder::parseInt(c.value.c_str(), l);
+                    err = nvs_set_i32(handle, nvsKey.c_str(), (int32_t)l);
+                    break;
+                case 'b':
+                    FormBinder::parseBool(c.value.c_str(), b);
+                    err = nvs_set_u8(handle, nvsKey.c_str(), b ? 1 : 0);
+                    break;
+                case 'f':
+                    f = strtof(c.value.c_str(), nullptr);
+                    err = nvs_set_blob(handle, nvsKey.c_str(), &f, sizeof(f));
+                    break;
+            }
+        }
+        if (err == ESP_OK) err = nvs_commit(handle);
+        nvs_close(handle);
+        if (err != ESP_OK) {
+            error = "Custom Data konnte nicht gespeichert werden (" + String(esp_err_to_name(err)) + ")";
+            return false;
+        }
+    }
+
+    // Netzwerk-Konfiguration: ein Datensatz, ein Schreibvorgang
+    bool networkChanged = newSSID != ssid || newPWD != password || newHostname != hostname ||
+                          newUseStaticIP != useStaticIP || newIP != ip || newGateway != gateway ||
+                          newSubnet != subnet || newDNS != dns;
+    bool ntpChanged = newNtpEnable != ntpEnable || newNtpServer != ntpServer;
+    if (networkChanged || ntpChanged) {
+        if (newSSID != ssid || newPWD != password) wifiBootAttempts = 0;
+        ssid = newSSID;
+        password = newPWD;
+        hostname = newHostname;
+        useStaticIP = newUseStaticIP;
+        ip = newIP;
+        gateway = newGateway;
+        subnet = newSubnet;
+        dns = newDNS;
+        ntpEnable = newNtpEnable;
+        ntpServer = newNtpServer;
+        if (!saveConfig()) {
+            error = "Netzwerk-Konfiguration konnte nicht gespeichert werden";
+            return false;
+        }
+        if (ntpChanged) requestNtpUpdate();
+    }
+
+    debugPrintf("Konfiguration importiert: %u Custom-Data-Werte%s\n", (unsigned)custom.size(),
+                networkChanged ? ", Netzwerk geändert - Neustart" : "");
+    // Höchstens ein Neustart, und nur wenn er nötig ist
+    if (networkChanged) shouldReboot = true;
+    return true;
+}
+
+void WiFiWebManager::appendImportData(AsyncWebServerRequest *request, size_t index, const uint8_t *data, size_t len) {
+    if (index == 0) {
+        importRequest = request;
+        importBuffer = "";
+        importOverflow = false;
+    }
+    if (importRequest != request) return;   // Paralleler Import: nur der erste zählt
+    if (importBuffer.length() + len > IMPORT_MAX_SIZE) {
+        importOverflow = true;
+        return;
+    }
+    importBuffer.concat((const char*)data, len);
+}
+
+// Passphrase für Export/Import: aus dem Formular-Body oder dem Header X-Config-Key.
+// In der URL (?key=) landet sie in Browser-Verlauf, Proxy- und Shell-Logs - das wird abgelehnt.
+static bool getConfigKey(AsyncWebServerRequest *request, String& key, String& error) {
+    if (request->hasParam("key")) {
+        error = "Passphrase nicht in der URL senden (Formularfeld 'key' oder Header X-Config-Key)";
+        return false;
+    }
+    if (request->hasParam("key", true)) key = request->getParam("key", true)->value();
+    else if (request->hasHeader("X-Config-Key")) key = request->header("X-Config-Key");
+    else key = "";
+    return true;
+}
+
+void WiFiWebManager::handleConfigImport(AsyncWebServerRequest *request) {
+    // Browser-Upload (multipart) bekommt eine HTML-Seite, Skripte (roher Body) eine Textantwort
+    bool fromForm = request->contentType().startsWith("multipart/");
+    auto param = [request](const char* name) -> String {
+        if (request->hasParam(name, true)) return request->getParam(name, true)->value();
+        if (request->hasParam(name)) return request->getParam(name)->value();
+        return String();
+    };
+    bool replace = false;
+    FormBinder::parseBool(param("replace").c_str(), replace);
+
+    int status = 200;
+    String error;
+    String key;
+    if (!getConfigKey(request, key, error)) {
+        status = 400;
+    } else if (importRequest != request) {
+        status = 400;
+        error = "Keine Daten empfangen";
+    } else if (importOverflow) {
+        status = 413;
+        error = "Datei zu groß (max. " + String((unsigned long)IMPORT_MAX_SIZE) + " Bytes)";
+    } else if (!importConfig(importBuffer, key, error, replace)) {
+        status = 400;
+    }
+    if (importRequest == request) {
+        importRequest = nullptr;
+        importBuffer = String();
+    }
+
+    String message = status == 200 ? String(shouldReboot ? "Konfiguration importiert. Neustart..." : "Konfiguration importiert.")
+                                   : "Fehler: " + error;
+    if (fromForm) {
+        String html = status == 200 ? "<p>" + message + "</p>" : "<div class='status-box status-error'>" + message + "</div>";
+        sendHtml(request, htmlWrap("Konfiguration", "/update", html + "<a href='/update'>Zurück</a>"));
+    } else {
+        request->send(status, "text/plain; charset=utf-8", message + "\n");
+    }
 }
 
 bool WiFiWebManager::isReservedKey(const String& key) {
@@ -486,48 +1320,13 @@ String WiFiWebManager::renderMenu(const String& currentPath) {
 }
 
 String WiFiWebManager::htmlWrap(const String& menutitle, const String& currentPath, const String& content) {
-    String css = R"rawliteral(
-      <style>
-      body{background:#f3f6fa;font-family:sans-serif;margin:0;}
-      .centerbox{max-width:420px;margin:2.5em auto;padding:2em;background:#fff;
-      border-radius:16px;box-shadow:0 0 24px #0002;display:flex;flex-direction:column;align-items:center;}
-      h1{font-size:1.6em;margin-bottom:1em;}h2{font-size:1.3em;margin:1.5em 0 1em;color:#2584fc;}
-      label{display:block;margin:1em 0 0.5em;font-weight:600;}
-      input,select{width:100%;font-size:1.1em;padding:0.8em;margin-bottom:1em;border-radius:8px;
-      border:1px solid #bbb;box-sizing:border-box;}button,input[type=submit]{width:100%;padding:1em;
-      font-size:1.1em;border:none;border-radius:8px;background:#2584fc;color:#fff;margin-top:0.7em;font-weight:700;
-      cursor:pointer;box-shadow:0 4px 8px #2584fc22;transition:background 0.2s;}
-      button:hover,input[type=submit]:hover{background:#1064b0;}
-      .nav-main{width:100%;margin-bottom:1.5em;}
-      .nav-std, .nav-custom {
-        display: flex;
-        flex-wrap: wrap;
-        justify-content: center;
-        gap: 1em;
-      }
-      .nav-custom { margin-top:0.2em; }
-      .nav-std a, .nav-custom a {
-        text-decoration:none;color:#2584fc;font-weight:600;font-size:1.1em;
-        padding-bottom:2px;border-bottom:2px solid transparent;transition:border-color 0.2s;
-      }
-      .nav-std a.selected, .nav-std a:hover,
-      .nav-custom a.selected, .nav-custom a:hover { border-color:#2584fc; }
-      .status-box{background:#f8f9fa;border:1px solid #e9ecef;border-radius:8px;padding:1em;margin:1em 0;}
-      .status-connected{border-color:#28a745;background:#f1f8e9;}
-      .status-ap{border-color:#ffc107;background:#fff3cd;}
-      .status-error{border-color:#dc3545;background:#f8d7da;}
-      option.stored-network{background-color:#e7f3ff;font-weight:bold;}
-      small{color:#6c757d;font-size:0.9em;}
-      @media (max-width:600px){
-        .centerbox{max-width:99vw;padding:1em;}
-        h1{font-size:1.2em;}
-        .nav-std a, .nav-custom a {font-size:1em;}
-      }
-      </style>
-    )rawliteral";
-    String html = "<!DOCTYPE html><html><head><meta name='viewport' content='width=device-width, initial-scale=1'>";
+    // CSS und JS kommen gzip-komprimiert aus dem Flash (siehe sendAsset()) und werden vom Browser gecacht
+    String html;
+    html.reserve(content.length() + 640);
+    html += "<!DOCTYPE html><html><head><meta name='viewport' content='width=device-width, initial-scale=1'>";
     html += "<title>" + menutitle + "</title>";
-    html += css;
+    html += "<link rel='stylesheet' href='/wwm/style.css'>";
+    html += "<script src='/wwm/live.js' defer></script>";
     html += "</head><body><div class='centerbox'>";
     html += renderMenu(currentPath);
     html += content;
@@ -535,6 +1334,198 @@ String WiFiWebManager::htmlWrap(const String& menutitle, const String& currentPa
     return html;
 }
 
+static bool acceptsGzip(AsyncWebServerRequest *request) {
+    return request->hasHeader("Accept-Encoding") && request->header("Accept-Encoding").indexOf("gzip") >= 0;
+}
+
+// gzip, wenn der Client es annimmt; sonst die minifizierte Fassung, falls das Asset eine hat.
+// Ohne Rohfassung ist gzip auch ohne Accept-Encoding zulässig (RFC 9110: dann gilt jede Kodierung
+// als akzeptiert) - nur wer gzip ausdrücklich ausschließt, bekommt 406.
+static bool chooseAssetEncoding(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset, bool& gzip) {
+    gzip = acceptsGzip(request) || !asset.rawData;
+    if (!gzip || acceptsGzip(request) || !request->hasHeader("Accept-Encoding")) return true;
+    request->send(406, "text/plain", "gzip erforderlich");
+    return false;
+}
+
+static AsyncWebServerResponse* beginAssetResponse(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset,
+                                                  bool gzip) {
+    AsyncWebServerResponse *response = gzip
+        ? request->beginResponse_P(200, asset.contentType, asset.data, asset.length)
+        : request->beginResponse_P(200, asset.contentType, asset.rawData, asset.rawLength);
+    if (gzip) response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("Vary", "Accept-Encoding");
+    return response;
+}
+
+void WiFiWebManager::sendAsset(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset) {
+    bool gzip;
+    if (!chooseAssetEncoding(request, asset, gzip)) return;
+    const char* etag = gzip ? asset.etag : asset.rawEtag;
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+        request->send(304);
+        return;
+    }
+    AsyncWebServerResponse *response = beginAssetResponse(request, asset, gzip);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "public, max-age=600");
+    request->send(response);
+}
+
+void WiFiWebManager::sendAssetBody(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset) {
+    // Antwort auf einen POST: kein ETag, kein 304, nicht cachen
+    bool gzip;
+    if (!chooseAssetEncoding(request, asset, gzip)) return;
+    AsyncWebServerResponse *response = beginAssetResponse(request, asset, gzip);
+    response->addHeader("Cache-Control", "no-store");
+    request->send(response);
+}
+
+static String jsonEscape(const String& value) {
+    String out;
+    out.reserve(value.length() + 2);
+    for (unsigned int i = 0; i < value.length(); i++) {
+        char c = value[i];
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((uint8_t)c < 0x20) {
+            char buf[8];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+String WiFiWebManager::renderStatusJson() {
+    bool connected = WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED;
+    String json = "{";
+    json += "\"version\":\"" + String(WiFiWebManagerInfo::getVersion()) + "\"";
+    json += ",\"uptime_ms\":" + String(millis());
+    json += ",\"heap_free\":" + String(ESP.getFreeHeap());
+    json += ",\"heap_min\":" + String(ESP.getMinFreeHeap());
+    json += ",\"heap_max_alloc\":" + String(ESP.getMaxAllocHeap());
+    json += ",\"mode\":\"" + String(WiFi.getMode() == WIFI_AP ? "ap" : "sta") + "\"";
+    json += ",\"connected\":" + String(connected ? "true" : "false");
+    json += ",\"hostname\":\"" + jsonEscape(getHostname()) + "\"";
+    if (connected) {
+        json += ",\"ssid\":\"" + jsonEscape(WiFi.SSID()) + "\"";
+        json += ",\"ip\":\"" + WiFi.localIP().toString() + "\"";
+        json += ",\"rssi\":" + String(WiFi.RSSI());
+    }
+    json += ",\"boot_attempts\":" + String(wifiBootAttempts);
+    if (ntpEnable) {
+        const WiFiWebManagerNtp::Status t = ntpStatusSnapshot();
+        json += ",\"ntp\":{\"synced\":" + String(t.synced ? "true" : "false");
+        json += ",\"server\":\"" + jsonEscape(t.server) + "\"";
+        json += ",\"stratum\":" + String(t.stratum);
+        json += ",\"offset_us\":" + String((long long)t.offsetUs);
+        json += ",\"delay_us\":" + String(t.delayUs);
+        json += ",\"drift_ppm\":" + String(t.driftPpm, 2);
+        json += ",\"poll_s\":" + String(t.pollIntervalS);
+        json += ",\"last_sync_age_s\":" + String(t.synced ? (long)((millis() - t.lastSyncMillis) / 1000) : -1L);
+        json += ",\"syncs\":" + String(t.syncCount);
+        json += ",\"steps\":" + String(t.stepCount);
+        json += ",\"failures\":" + String(t.failCount);
+        json += ",\"last_error\":\"" + jsonEscape(t.lastError) + "\"}";
+    }
+    json += "}";
+    return json;
+}
+
+// Hält die Seite, solange der Deflater sie liest; der komprimierte Stream selbst wird
+// blockweise direkt in die TCP-Puffer geschrieben
+struct GzipPageStream {
+    String html;
+    WiFiWebManagerGzip::Deflater deflater;
+    unsigned long cpuUs = 0;
+
+    explicit GzipPageStream(String&& page)
+        : html(std::move(page)), deflater((const uint8_t*)html.c_str(), html.length()) {}
+};
+
+void WiFiWebManager::sendHtml(AsyncWebServerRequest *request, String html) {
+    bool compressible = isCompressible(request);
+    // HTTP/1.0 kennt kein Chunked Encoding - dort ginge die Länge des Streams verloren
+    if (compressible && html.length() >= compressionThreshold && acceptsGzip(request) && request->version() > 0) {
+        auto stream = std::make_shared<GzipPageStream>(std::move(html));
+        if (stream->deflater.begin()) {
+            String url = request->url();
+            AsyncWebServerResponse *response = request->beginChunkedResponse("text/html; charset=utf-8",
+                [this, stream, url](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                    unsigned long start = micros();
+                    size_t n = stream->deflater.read(buffer, maxLen);
+                    stream->cpuUs += micros() - start;
+                    if (n == 0) {
+                        debugPrintf("gzip %s: %u -> %u Bytes in %lu us\n", url.c_str(),
+                                    (unsigned)stream->html.length(), (unsigned)stream->deflater.totalOut(), stream->cpuUs);
+                    }
+                    return n;
+                });
+            response->addHeader("Content-Encoding", "gzip");
+            response->addHeader("Vary", "Accept-Encoding");
+            request->send(response);
+            return;
+        }
+        // Kein Speicher für die Hash-Tabellen: unkomprimiert senden
+        html = std::move(stream->html);
+    }
+    AsyncWebServerResponse *response = request->beginResponse(200, "text/html; charset=utf-8", html);
+    if (compressible) response->addHeader("Vary", "Accept-Encoding");
+    request->send(response);
+}
+
+bool WiFiWebManager::isCompressible(AsyncWebServerRequest *request) {
+    if (!compressionEnabled) return false;
+    for (const auto& path : uncompressedPaths) {
+        if (request->url() == path) return false;
+    }
+    return true;
+}
+
+void WiFiWebManager::setCompression(bool enabled, size_t minSize) {
+    compressionEnabled = enabled;
+    compressionThreshold = minSize;
+}
+
+void WiFiWebManager::setPageCompression(const String& path, bool enabled) {
+    for (auto it = uncompressedPaths.begin(); it != uncompressedPaths.end(); ++it) {
+        if (*it == path) { uncompressedPaths.erase(it); break; }
+    }
+    if (!enabled) uncompressedPaths.push_back(path);
+}
+
+String WiFiWebManager::renderStatusBox() {
+    String content;
+    if (WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
+        content += "<div class='status-box status-connected'>";
+        content += "<strong>✓ Verbunden</strong><br>";
+        content += "<strong>SSID:</strong> " + WiFi.SSID() + "<br>";
+        content += "<strong>IP:</strong> " + WiFi.localIP().toString() + "<br>";
+        content += "<strong>Signal:</strong> " + String(WiFi.RSSI()) + " dBm";
+        content += "</div>";
+    } else if (WiFi.getMode() == WIFI_AP) {
+        content += "<div class='status-box status-ap'>";
+        content += "<strong>⚠ Setup-Modus</strong><br>";
+        if (wifiBootAttempts >= MAX_BOOT_ATTEMPTS) {
+            content += "Grund: " + String(MAX_BOOT_ATTEMPTS) + " Verbindungsversuche fehlgeschlagen<br>";
+        } else {
+            content += "Grund: Kein WLAN konfiguriert<br>";
+        }
+        content += "<strong>SSID:</strong> ESP32_SETUP<br>";
+        content += "<strong>IP:</strong> 192.168.4.1";
+        content += "</div>";
+    } else {
+        content += "<div class='status-box status-error'>";
+        content += "<strong>✗ Unbekannter Status</strong>";
+        content += "</div>";
+    }
+    return content;
+}
+
 void WiFiWebManager::addPage(const String& menutitle, const String& path, ContentHandler getHandler, ContentHandler postHandler) {
     if (path == "/") {
         this->rootGetHandler = getHandler;
@@ -550,78 +1541,472 @@ void WiFiWebManager::addPage(const String& menutitle, const String& path, Conten
     // GET
     server.on(path.c_str(), HTTP_GET, [this, path, menutitle, getHandler](AsyncWebServerRequest *request) {
         String content = getHandler ? getHandler(request) : "<p>(Keine Seite definiert)</p>";
-        String html = htmlWrap(menutitle, path, content);
-        request->send(200, "text/html; charset=utf-8", html);
+        sendHtml(request, htmlWrap(menutitle, path, content));
     });
     
     // POST
     if (postHandler) {
         server.on(path.c_str(), HTTP_POST, [this, path, menutitle, postHandler](AsyncWebServerRequest *request){
             String content = postHandler(request);
-            String html = htmlWrap(menutitle, path, content);
-            request->send(200, "text/html; charset=utf-8", html);
+            sendHtml(request, htmlWrap(menutitle, path, content));
         });
     }
 }
 
+struct WiFiWebManager::DeferredResponse::State {
+    mutable std::mutex lock;
+    bool done = false;      // Inhalt geliefert oder Timeout abgelaufen
+    String content;
+};
+
+void WiFiWebManager::DeferredResponse::complete(const String& content) {
+    if (!state) return;
+    std::lock_guard<std::mutex> guard(state->lock);
+    if (state->done) return; // zu spät - Fallback wurde bereits gesendet
+    state->content = content;
+    state->done = true;
+}
+
+bool WiFiWebManager::DeferredResponse::isPending() const {
+    if (!state) return false;
+    std::lock_guard<std::mutex> guard(state->lock);
+    return !state->done;
+}
+
+void WiFiWebManager::addDeferredPage(const String& menutitle, const String& path, DeferredHandler getHandler,
+                                     unsigned long timeoutMs, const String& fallbackContent) {
+    for (auto it = customPages.begin(); it != customPages.end(); ++it) {
+        if (it->path == path) { customPages.erase(it); break; }
+    }
+    customPages.push_back({menutitle, path, nullptr, nullptr});
+
+    server.on(path.c_str(), HTTP_GET, [this, path, menutitle, getHandler, timeoutMs, fallbackContent](AsyncWebServerRequest *request) {
+        DeferredResponse handle;
+        handle.state = std::make_shared<DeferredResponse::State>();
+        auto state = handle.state;
+        if (getHandler) getHandler(request, handle);
+
+        // Schneller Pfad: Handler hat bereits synchron geantwortet.
+        // HTTP/1.0 kennt kein Chunked Encoding - ESPAsyncWebServer fiele dort auf eine Antwort der
+        // Länge 0 zurück und die Seite käme leer an. Solche Clients bekommen sofort den Fallback-Inhalt
+        // mit Content-Length, ein späteres complete() wird ignoriert.
+        bool ready;
+        String content;
+        {
+            std::lock_guard<std::mutex> guard(state->lock);
+            if (!state->done && request->version() == 0) {
+                state->content = fallbackContent;
+                state->done = true;
+                debugPrintf("Deferred-Seite %s: HTTP/1.0-Client, Fallback gesendet\n", path.c_str());
+            }
+            ready = state->done;
+            if (ready) content = state->content;
+        }
+        if (ready) {
+            sendHtml(request, htmlWrap(menutitle, path, content));
+            return;
+        }
+
+        // Sonst: Chunked-Response, die bis zum Ergebnis (oder Timeout) RESPONSE_TRY_AGAIN liefert.
+        // Der async_tcp-Task ist dadurch nicht blockiert. Abgefragt wird nur im Poll-Takt der
+        // Verbindung (AsyncTCP: ca. alle 500 ms) - ein Ergebnis kommt also bis zu 500 ms später an.
+        unsigned long started = millis();
+        auto body = std::make_shared<String>();
+        AsyncWebServerResponse *response = request->beginChunkedResponse("text/html; charset=utf-8",
+            [this, state, body, started, timeoutMs, fallbackContent, menutitle, path](uint8_t *buffer, size_t maxLen, size_t index) -> size_t {
+                if (index == 0 && body->length() == 0) {
+                    String content;
+                    {
+                        std::lock_guard<std::mutex> guard(state->lock);
+                        if (!state->done) {
+                            if (millis() - started < timeoutMs) return RESPONSE_TRY_AGAIN;
+                            state->content = fallbackContent;
+                            state->done = true;
+                            debugPrintf("Deferred-Seite %s: Timeout nach %lu ms\n", path.c_str(), timeoutMs);
+                        }
+                        content = state->content;
+                    }
+                    *body = htmlWrap(menutitle, path, content);
+                }
+                if (index >= body->length()) return 0;
+                size_t n = body->length() - index;
+                if (n > maxLen) n = maxLen;
+                memcpy(buffer, body->c_str() + index, n);
+                return n;
+            });
+        request->send(response);
+    });
+}
+
+void WiFiWebManager::addFragment(const String& pagePath, const String& name, ContentHandler handler, unsigned long refreshMs) {
+    for (auto& f : fragments) {
+        if (f.page == pagePath && f.name == name) {
+            f.handler = handler;
+            f.refreshMs = refreshMs;
+            return;
+        }
+    }
+    fragments.push_back({pagePath, name, handler, refreshMs});
+}
+
+// Query-Wert prozentkodieren (Pfad und Name eigener Fragmente sind frei wählbar, z.B. "a&b", "x y")
+static String urlEncode(const String& value) {
+    static const char hex[] = "0123456789ABCDEF";
+    String out;
+    out.reserve(value.length());
+    for (unsigned int i = 0; i < value.length(); i++) {
+        uint8_t c = value[i];
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~' || c == '/') {
+            out += (char)c;
+        } else {
+            out += '%';
+            out += hex[c >> 4];
+            out += hex[c & 0x0F];
+        }
+    }
+    return out;
+}
+
+// Für Attributwerte in einfachen Anführungszeichen
+static String htmlAttrEscape(const String& value) {
+    String out;
+    out.reserve(value.length());
+    for (unsigned int i = 0; i < value.length(); i++) {
+        char c = value[i];
+        switch (c) {
+            case '&':  out += "&amp;"; break;
+            case '<':  out += "&lt;"; break;
+            case '>':  out += "&gt;"; break;
+            case '\'': out += "&#39;"; break;
+            case '"':  out += "&quot;"; break;
+            default:   out += c;
+        }
+    }
+    return out;
+}
+
+String WiFiWebManager::renderFragment(AsyncWebServerRequest *request, const String& pagePath, const String& name) {
+    for (const auto& f : fragments) {
+        if (f.page == pagePath && f.name == name) {
+            // handleFragment() bekommt page/name vom Webserver bereits dekodiert
+            String url = "/wwm/fragment?page=" + urlEncode(pagePath) + "&name=" + urlEncode(name);
+            String html = "<div data-live='" + htmlAttrEscape(url) + "'";
+            html += " data-refresh='" + String(f.refreshMs) + "'>";
+            if (f.handler) html += f.handler(request);
+            html += "</div>";
+            return html;
+        }
+    }
+    return "";
+}
+
+void WiFiWebManager::handleFragment(AsyncWebServerRequest *request) {
+    if (!request->hasParam("page") || !request->hasParam("name")) {
+        request->send(400, "text/plain", "page und name erforderlich");
+        return;
+    }
+    const String& pagePath = request->getParam("page")->value();
+    const String& name = request->getParam("name")->value();
+
+    for (const auto& f : fragments) {
+        if (f.page != pagePath || f.name != name) continue;
+
+        String content = f.handler ? f.handler(request) : String();
+        // ETag über den Inhalt: unveränderte Fragmente kosten nur eine 304-Antwort
+        char etag[12];
+        snprintf(etag, sizeof(etag), "\"%08x\"",
+                 (unsigned)WiFiWebManagerGzip::crc32(0, (const uint8_t*)content.c_str(), content.length()));
+        AsyncWebServerResponse *response;
+        if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == etag) {
+            response = request->beginResponse(304);
+        } else {
+            response = request->beginResponse(200, "text/html; charset=utf-8", content);
+        }
+        response->addHeader("ETag", etag);
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+        return;
+    }
+    request->send(404, "text/plain", "Fragment nicht gefunden");
+}
+
 void WiFiWebManager::removePage(const String& path) {
     for (auto it = customPages.begin(); it != customPages.end(); ++it) {
         if (it->path == path) { customPages.erase(it); break; }
     }
 }
 
+void WiFiWebManager::serveStatic(const String& urlPrefix, const String& fsPath) {
+    // "/static/" und "/static" gleich behandeln; der Handler greift auch für alle Unterpfade
+    String prefix = urlPrefix;
+    while (prefix.endsWith("/")) prefix.remove(prefix.length() - 1);
+    if (prefix.length() == 0) {
+        // "/" würde alle Standard-Seiten und das Captive Portal verdecken
+        debugPrintln("Fehler: serveStatic() mit Präfix \"/\" wird nicht unterstützt!");
+        return;
+    }
+
+    if (!fsMounted) {
+        fsMounted = LittleFS.begin(false);
+        if (!fsMounted) {
+            debugPrintln("Fehler: LittleFS konnte nicht gemountet werden!");
+            return;
+        }
+        debugPrintln("LittleFS gemountet.");
+    }
+
+    String root = fsPath;
+    if (root.endsWith("/")) root.remove(root.length() - 1);
+
+    server.on(prefix.c_str(), HTTP_GET, [this, prefix, root](AsyncWebServerRequest *request){
+        handleStaticFile(request, prefix, root);
+    });
+    debugPrintf("Statische Dateien: %s -> LittleFS:%s\n", prefix.c_str(), root.c_str());
+}
+
+String WiFiWebManager::getContentType(const String& path) {
+    struct MimeEntry { const char* ext; const char* type; };
+    static const MimeEntry mimeTypes[] = {
+        {".html", "text/html; charset=utf-8"}, {".htm", "text/html; charset=utf-8"},
+        {".css", "text/css"}, {".js", "application/javascript"}, {".json", "application/json"},
+        {".csv", "text/csv"}, {".txt", "text/plain; charset=utf-8"}, {".svg", "image/svg+xml"},
+        {".png", "image/png"}, {".jpg", "image/jpeg"}, {".jpeg", "image/jpeg"}, {".gif", "image/gif"},
+        {".ico", "image/x-icon"}, {".woff2", "font/woff2"}, {".bin", "application/octet-stream"}
+    };
+    for (const auto& m : mimeTypes) {
+        if (path.endsWith(m.ext)) return m.type;
+    }
+    return "application/octet-stream";
+}
+
+// Eine Grenze des Range-Headers: nur Ziffern, zu große Werte werden auf SIZE_MAX begrenzt
+static bool parseRangeBound(const String& text, size_t& value) {
+    if (text.length() == 0) return false;
+    value = 0;
+    for (unsigned int i = 0; i < text.length(); i++) {
+        char c = text[i];
+        if (c < '0' || c > '9') return false;
+        size_t digit = c - '0';
+        value = value > (SIZE_MAX - digit) / 10 ? SIZE_MAX : value * 10 + digit;
+    }
+    return true;
+}
+
+// Wertet einen "Range: bytes=..."-Header aus.
+// Rückgabe: 1 = gültiger Bereich, 0 = Header ignorieren (ganze Datei), -1 = nicht erfüllbar (416)
+static int parseRangeHeader(const String& header, size_t fileSize, size_t& start, size_t& end) {
+    if (!header.startsWith("bytes=") || header.indexOf(',') >= 0) return 0;
+    int dash = header.indexOf('-');
+    if (dash < 0) return 0;
+
+    String first = header.substring(6, dash);
+    String last = header.substring(dash + 1);
+    first.trim();
+    last.trim();
+    // Syntaktisch ungültige Bereiche (z.B. "bytes=abc-") werden laut RFC 9110 ignoriert
+    if (first.length() == 0) {
+        // Suffix-Bereich: die letzten N Bytes
+        size_t suffix;
+        if (!parseRangeBound(last, suffix)) return 0;
+        if (suffix == 0) return -1;
+        start = suffix >= fileSize ? 0 : fileSize - suffix;
+        end = fileSize - 1;
+    } else {
+        if (!parseRangeBound(first, start)) return 0;
+        if (last.length() == 0) {
+            end = fileSize - 1;
+        } else {
+            if (!parseRangeBound(last, end) || end < start) return 0;
+            if (end >= fileSize) end = fileSize - 1;
+        }
+    }
+    if (fileSize == 0 || start >= fileSize) return -1;
+    return 1;
+}
+
+static String formatHttpDate(time_t t) {
+    struct tm tmv;
+    gmtime_r(&t, &tmv);
+    char buf[32];
+    strftime(buf, sizeof(buf), "%a, %d %b %Y %H:%M:%S GMT", &tmv);
+    return String(buf);
+}
+
+void WiFiWebManager::handleStaticFile(AsyncWebServerRequest *request, const String& urlPrefix, const String& fsPath) {
+    String path = fsPath + request->url().substring(urlPrefix.length());
+    if (path.indexOf("..") >= 0) {
+        request->send(403, "text/plain", "Forbidden");
+        return;
+    }
+    if (path.length() == 0 || path.endsWith("/")) path += "index.html";
+
+    String contentType = getContentType(path);
+
+    // Vorkomprimierte Variante bevorzugen, wenn der Client gzip versteht
+    bool gzipped = false;
+    if (acceptsGzip(request) && LittleFS.exists(path + ".gz")) {
+        path += ".gz";
+        gzipped = true;
+    }
+
+    File file = LittleFS.open(path, "r");
+    if (!file || file.isDirectory()) {
+        request->send(404, "text/plain", "Not found");
+        return;
+    }
+
+    size_t fileSize = file.size();
+    time_t lastWrite = file.getLastWrite();
+    char etag[40];
+    snprintf(etag, sizeof(etag), "\"%x-%lx%s\"", (unsigned)fileSize, (unsigned long)lastWrite, gzipped ? "-gz" : "");
+    String lastModified = lastWrite > 0 ? formatHttpDate(lastWrite) : "";
+
+    // Conditional Request: If-None-Match hat Vorrang vor If-Modified-Since
+    bool notModified = false;
+    if (request->hasHeader("If-None-Match")) {
+        notModified = request->header("If-None-Match") == etag;
+    } else if (lastModified.length() > 0 && request->hasHeader("If-Modified-Since")) {
+        notModified = request->header("If-Modified-Since") == lastModified;
+    }
+    if (notModified) {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", etag);
+        request->send(response);
+        return;
+    }
+
+    size_t start = 0;
+    size_t end = fileSize > 0 ? fileSize - 1 : 0;
+    bool partial = false;
+    if (request->hasHeader("Range") && fileSize > 0) {
+        int range = parseRangeHeader(request->header("Range"), fileSize, start, end);
+        if (range < 0) {
+            AsyncWebServerResponse *response = request->beginResponse(416);
+            response->addHeader("Content-Range", "bytes */" + String((unsigned long)fileSize));
+            request->send(response);
+            return;
+        }
+        partial = range > 0;
+    }
+
+    size_t length = fileSize > 0 ? end - start + 1 : 0;
+    if (start > 0) file.seek(start);
+
+    // Datei wird in Blöcken von max. STATIC_CHUNK_SIZE gelesen - Speicherbedarf unabhängig von der Dateigröße
+    AsyncWebServerResponse *response = request->beginResponse(contentType, length,
+        [file, length](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+            size_t n = length - index;
+            if (n > maxLen) n = maxLen;
+            if (n > STATIC_CHUNK_SIZE) n = STATIC_CHUNK_SIZE;
+            return n > 0 ? file.read(buffer, n) : 0;
+        });
+
+    if (partial) {
+        response->setCode(206);
+        response->addHeader("Content-Range", "bytes " + String((unsigned long)start) + "-" +
+                            String((unsigned long)end) + "/" + String((unsigned long)fileSize));
+    }
+    if (gzipped) response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("Vary", "Accept-Encoding");
+    response->addHeader("Accept-Ranges", "bytes");
+    response->addHeader("ETag", etag);
+    if (lastModified.length() > 0) response->addHeader("Last-Modified", lastModified);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+}
+
 void WiFiWebManager::setupWebServer() {
     // Home-Seite mit Status
     server.on("/", HTTP_GET, [this](AsyncWebServerRequest *request){
         if (rootGetHandler) {
             String content = rootGetHandler(request);
-            request->send(200, "text/html; charset=utf-8", htmlWrap("Home", "/", content));
+            sendHtml(request, htmlWrap("Home", "/", content));
         } else {
             String content = "<h1>WiFi Status</h1>";
-            
-            if (WiFi.getMode() == WIFI_STA && WiFi.status() == WL_CONNECTED) {
-                content += "<div class='status-box status-connected'>";
-                content += "<strong>✓ Verbunden</strong><br>";
-                content += "<strong>SSID:</strong> " + WiFi.SSID() + "<br>";
-                content += "<strong>IP:</strong> " + WiFi.localIP().toString() + "<br>";
-                content += "<strong>Signal:</strong> " + String(WiFi.RSSI()) + " dBm";
-                content += "</div>";
-            } else if (WiFi.getMode() == WIFI_AP) {
-                content += "<div class='status-box status-ap'>";
-                content += "<strong>⚠ Setup-Modus</strong><br>";
-                if (wifiBootAttempts >= MAX_BOOT_ATTEMPTS) {
-                    content += "Grund: " + String(MAX_BOOT_ATTEMPTS) + " Verbindungsversuche fehlgeschlagen<br>";
-                } else {
-                    content += "Grund: Kein WLAN konfiguriert<br>";
-                }
-                content += "<strong>SSID:</strong> ESP32_SETUP<br>";
-                content += "<strong>IP:</strong> 192.168.4.1";
-                content += "</div>";
-            } else {
-                content += "<div class='status-box status-error'>";
-                content += "<strong>✗ Unbekannter Status</strong>";
-                content += "</div>";
-            }
+            content += renderFragment(request, "/", "status");
             
             if (getHostname().length() > 0) {
                 content += "<p><strong>Hostname:</strong> " + getHostname() + "</p>";
             }
             
-            request->send(200, "text/html; charset=utf-8", htmlWrap("Home", "/", content));
+            sendHtml(request, htmlWrap("Home", "/", content));
         }
     });
 
-    // WLAN-Konfiguration
-    server.on("/wlan", HTTP_GET, [this](AsyncWebServerRequest *request){
-        String html = "<h1>WLAN Konfiguration</h1>";
-        
-        // Aktuelle WLAN-Konfiguration anzeigen
+    // Statische Assets (CSS/JS) direkt aus dem Flash
+    for (const WiFiWebManagerAssets::Asset* asset : WiFiWebManagerAssets::STATIC_ASSETS) {
+        server.on(asset->path, HTTP_GET, [this, asset](AsyncWebServerRequest *request){
+            sendAsset(request, *asset);
+        });
+    }
+
+    // Fragmente der Standardseiten - werden vom Live-Skript einzeln nachgeladen
+    addFragment("/", "status", [this](AsyncWebServerRequest *request) {
+        return renderStatusBox();
+    });
+    addFragment("/wlan", "stored", [this](AsyncWebServerRequest *request) {
+        String html;
         if (ssid.length() > 0) {
             html += "<div class='status-box'>";
             html += "<strong>Gespeichertes WLAN:</strong> " + ssid + "<br>";
             html += "<strong>Boot-Versuche:</strong> " + String(wifiBootAttempts) + "/" + String(MAX_BOOT_ATTEMPTS);
             html += "</div>";
         }
+        return html;
+    }, 10000);
+    addFragment("/update", "memory", [](AsyncWebServerRequest *request) {
+        return "<p><strong>Freier Speicher:</strong> " + String(ESP.getFreeHeap()) + " Bytes</p>";
+    }, 10000);
+
+    addFragment("/ntp", "sync", [this](AsyncWebServerRequest *request) {
+        if (!ntpEnable) return String();
+        const WiFiWebManagerNtp::Status t = ntpStatusSnapshot();
+        String html = t.synced ? "<div class='status-box'>" : "<div class='status-box status-error'>";
+        if (t.synced) {
+            char buf[32];
+            time_t now = time(nullptr);
+            struct tm tmv;
+            gmtime_r(&now, &tmv);
+            strftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S", &tmv);
+            html += "<strong>Uhrzeit (UTC):</strong> " + String(buf) + "<br>";
+            html += "<strong>Server:</strong> " + t.server + " (Stratum " + String(t.stratum) + ")<br>";
+            // Nach dem Stellen der Uhr (v.a. beim ersten Mal ab 1970) ist der Offset sehr groß
+            if (llabs(t.offsetUs) >= 1000000) {
+                html += "<strong>Offset:</strong> " + String((long long)(t.offsetUs / 1000000)) + " s (gestellt), ";
+            } else {
+                html += "<strong>Offset:</strong> " + String(t.offsetUs / 1000.0f, 1) + " ms, ";
+            }
+            html += "<strong>Laufzeit:</strong> " + String(t.delayUs / 1000.0f, 1) + " ms<br>";
+            html += "<strong>Drift:</strong> " + String(t.driftPpm, 1) + " ppm<br>";
+            html += "<strong>Letzte Synchronisation:</strong> vor " + String((millis() - t.lastSyncMillis) / 1000) + " s, ";
+            html += "<strong>Intervall:</strong> " + String(t.pollIntervalS) + " s<br>";
+        } else {
+            html += "<strong>Noch nicht synchronisiert</strong><br>";
+        }
+        html += "<strong>Abfragen:</strong> " + String(t.syncCount) + " ok, " + String(t.stepCount) + " gestellt, " +
+                String(t.failCount) + " fehlgeschlagen";
+        if (t.lastError[0]) html += "<br><strong>Letzter Fehler:</strong> " + String(t.lastError);
+        html += "</div>";
+        return html;
+    }, 10000);
+
+    server.on("/wwm/fragment", HTTP_GET, [this](AsyncWebServerRequest *request){
+        handleFragment(request);
+    });
+
+    // Maschinenlesbarer Status (Monitoring, Lasttests)
+    server.on("/api/status", HTTP_GET, [this](AsyncWebServerRequest *request){
+        AsyncWebServerResponse *response = request->beginResponse(200, "application/json", renderStatusJson());
+        response->addHeader("Cache-Control", "no-cache");
+        request->send(response);
+    });
+
+    // WLAN-Konfiguration
+    server.on("/wlan", HTTP_GET, [this](AsyncWebServerRequest *request){
+        String html = "<h1>WLAN Konfiguration</h1>";
+        
+        // Aktuelle WLAN-Konfiguration anzeigen
+        html += renderFragment(request, "/wlan", "stored");
         
         html += "<form action='/wlan_save' method='POST'>";
         html += "<label>SSID:</label><select name='ssid'>";
@@ -649,36 +2034,47 @@ void WiFiWebManager::setupWebServer() {
         html += "<input type='submit' value='Netzwerk speichern'>";
         html += "</form>";
         
-        request->send(200, "text/html; charset=utf-8", htmlWrap("WLAN Konfiguration", "/wlan", html));
+        sendHtml(request, htmlWrap("WLAN Konfiguration", "/wlan", html));
     });
 
     // WLAN speichern
     server.on("/wlan_save", HTTP_POST, [this](AsyncWebServerRequest *request){
-        String newSSID = request->hasParam("ssid", true) ? request->getParam("ssid", true)->value() : "";
-        String newPWD = request->hasParam("pwd", true) ? request->getParam("pwd", true)->value() : "";
+        String newSSID, newPWD;
+        FormBinder form;
+        form.bind("ssid", newSSID, 32, true)
+            .bind("pwd", newPWD, 64);
         
-        if (newSSID.length() > 0) {
+        if (form.parse(request)) {
             ssid = newSSID;
             password = newPWD;
-            resetBootAttempts(); // Reset der Versuche bei neuer Konfiguration
+            wifiBootAttempts = 0; // Reset der Versuche bei neuer Konfiguration
             saveConfig();
             shouldReboot = true;
-            request->send(200, "text/html; charset=utf-8", 
-                htmlWrap("WLAN gespeichert", "/wlan", "<p>WLAN-Daten gespeichert! Neustart...</p>"));
+            sendHtml(request, htmlWrap("WLAN gespeichert", "/wlan", "<p>WLAN-Daten gespeichert! Neustart...</p>"));
         } else {
-            request->send(200, "text/html; charset=utf-8", 
-                htmlWrap("Fehler", "/wlan", "<p>SSID darf nicht leer sein!</p><a href='/wlan'>Zurück</a>"));
+            sendHtml(request, htmlWrap("Fehler", "/wlan", form.errorHtml() + "<a href='/wlan'>Zurück</a>"));
         }
     });
 
     // Netzwerk-Einstellungen speichern
     server.on("/network_save", HTTP_POST, [this](AsyncWebServerRequest *request){
-        String newHostname = request->hasParam("hostname", true) ? request->getParam("hostname", true)->value() : "";
-        bool newUseStaticIP = request->hasParam("useStaticIP", true);
-        String newIP = request->hasParam("ip", true) ? request->getParam("ip", true)->value() : "";
-        String newGateway = request->hasParam("gateway", true) ? request->getParam("gateway", true)->value() : "";
-        String newSubnet = request->hasParam("subnet", true) ? request->getParam("subnet", true)->value() : "";
-        String newDNS = request->hasParam("dns", true) ? request->getParam("dns", true)->value() : "";
+        String newHostname, newIP, newGateway, newSubnet, newDNS;
+        bool newUseStaticIP = false;
+        FormBinder form;
+        form.bind("hostname", newHostname, 63)
+            .bindCheckbox("useStaticIP", newUseStaticIP)
+            .bindIP("ip", newIP)
+            .bindIP("gateway", newGateway)
+            .bindIP("subnet", newSubnet)
+            .bindIP("dns", newDNS);
+        form.parse(request);
+        if (newUseStaticIP && (newIP.length() == 0 || newGateway.length() == 0 || newSubnet.length() == 0 || newDNS.length() == 0)) {
+            form.addError("Statische IP benötigt IP-Adresse, Gateway, Subnetz und DNS");
+        }
+        if (form.hasErrors()) {
+            sendHtml(request, htmlWrap("Fehler", "/wlan", form.errorHtml() + "<a href='/wlan'>Zurück</a>"));
+            return;
+        }
         
         hostname = newHostname;
         useStaticIP = newUseStaticIP;
@@ -689,8 +2085,7 @@ void WiFiWebManager::setupWebServer() {
         
         saveConfig();
         shouldReboot = true;
-        request->send(200, "text/html; charset=utf-8", 
-            htmlWrap("Netzwerk gespeichert", "/wlan", "<p>Netzwerk-Einstellungen gespeichert! Neustart...</p>"));
+        sendHtml(request, htmlWrap("Netzwerk gespeichert", "/wlan", "<p>Netzwerk-Einstellungen gespeichert! Neustart...</p>"));
     });
 
     // Reset-Seite
@@ -711,55 +2106,62 @@ void WiFiWebManager::setupWebServer() {
         html += "<input type='submit' value='Kompletter Werks-Reset' style='background:#dc3545;'>";
         html += "</form>";
         
-        request->send(200, "text/html; charset=utf-8", htmlWrap("Reset", "/reset", html));
+        sendHtml(request, htmlWrap("Reset", "/reset", html));
     });
 
     // WLAN-Reset
     server.on("/reset_wifi", HTTP_POST, [this](AsyncWebServerRequest *request){
+        publishEvent(WiFiWebManagerEvent::ResetRequested, 0);
         clearWiFiConfig();
         shouldReboot = true;
-        request->send(200, "text/html; charset=utf-8", 
-            htmlWrap("WLAN Reset", "/reset", "<p>WLAN-Daten gelöscht! Neustart...</p>"));
+        sendHtml(request, htmlWrap("WLAN Reset", "/reset", "<p>WLAN-Daten gelöscht! Neustart...</p>"));
     });
 
     // Vollständiger Reset
     server.on("/reset_all", HTTP_POST, [this](AsyncWebServerRequest *request){
+        publishEvent(WiFiWebManagerEvent::ResetRequested, 1);
         clearAllConfig();
         shouldReboot = true;
-        request->send(200, "text/html; charset=utf-8", 
-            htmlWrap("Werks-Reset", "/reset", "<p>Werks-Reset durchgeführt! Neustart...</p>"));
+        sendHtml(request, htmlWrap("Werks-Reset", "/reset", "<p>Werks-Reset durchgeführt! Neustart...</p>"));
     });
 
     // NTP-Konfiguration
     server.on("/ntp", HTTP_GET, [this](AsyncWebServerRequest *request){
         String html = "<h1>NTP Einstellungen</h1>";
+        html += renderFragment(request, "/ntp", "sync");
         html += "<form action='/ntp_save' method='POST'>";
         html += "<label><input type='checkbox' name='ntpEnable' ";
         html += (ntpEnable ? "checked" : "");
         html += "> NTP aktivieren</label>";
-        html += "<label>NTP Server:</label>";
+        html += "<label>NTP Server (mehrere durch Komma getrennt):</label>";
         html += "<input name='ntpServer' value='" + ntpServer + "'>";
         html += "<input type='submit' value='Speichern'>";
         html += "</form>";
         
-        request->send(200, "text/html; charset=utf-8", htmlWrap("NTP Einstellungen", "/ntp", html));
+        sendHtml(request, htmlWrap("NTP Einstellungen", "/ntp", html));
     });
 
     server.on("/ntp_save", HTTP_POST, [this](AsyncWebServerRequest *request){
-        bool newNtpEnable = request->hasParam("ntpEnable", true);
-        String newNtpServer = request->hasParam("ntpServer", true) ? request->getParam("ntpServer", true)->value() : "pool.ntp.org";
+        bool newNtpEnable = false;
+        String newNtpServer = "pool.ntp.org";
+        FormBinder form;
+        form.bindCheckbox("ntpEnable", newNtpEnable)
+            .bind("ntpServer", newNtpServer, 128);
+        if (!form.parse(request)) {
+            sendHtml(request, htmlWrap("Fehler", "/ntp", form.errorHtml() + "<a href='/ntp'>Zurück</a>"));
+            return;
+        }
         
         saveNtpConfig(newNtpEnable, newNtpServer);
-        request->send(200, "text/html; charset=utf-8", 
-            htmlWrap("NTP Einstellungen", "/ntp", "<p>NTP-Einstellungen gespeichert!</p><a href='/ntp'>Zurück</a>"));
+        sendHtml(request, htmlWrap("NTP Einstellungen", "/ntp", "<p>NTP-Einstellungen gespeichert!</p><a href='/ntp'>Zurück</a>"));
     });
 
     // OTA Firmware Update
     server.on("/update", HTTP_GET, [this](AsyncWebServerRequest *request){
         String html = "<h1>Firmware Update</h1>";
         html += "<div class='status-box'>";
-        html += "<p><strong>Aktuelle Firmware:</strong> " + String(__DATE__) + " " + String(__TIME__) + "</p>";
-        html += "<p><strong>Freier Speicher:</strong> " + String(ESP.getFreeHeap()) + " Bytes</p>";
+        html += "<p><strong>Aktuelle Firmware:</strong> " + firmwareBuild() + "</p>";
+        html += renderFragment(request, "/update", "memory");
         html += "</div>";
         
         html += "<form method='POST' action='/update' enctype='multipart/form-data'>";
@@ -769,21 +2171,83 @@ void WiFiWebManager::setupWebServer() {
         html += "</form>";
         
         html += "<p><small>Warnung: Unterbrechen Sie den Update-Vorgang nicht!</small></p>";
+
+        html += "<h2>Konfiguration</h2>";
+        html += "<form method='POST' action='/config/export'>";
+        html += "<label>Passphrase (optional, sonst ohne Passwörter):</label>";
+        html += "<input type='password' name='key' autocomplete='off'>";
+        html += "<input type='submit' value='Exportieren'>";
+        html += "</form>";
+        html += "<form method='POST' action='/config/import' enctype='multipart/form-data'>";
+        html += "<label>Konfigurationsdatei:</label>";
+        html += "<input type='file' name='config' accept='.txt'>";
+        html += "<label>Passphrase:</label>";
+        html += "<input type='password' name='key' autocomplete='off'>";
+        html += "<label><input type='checkbox' name='replace' value='1'> Vorhandene Custom Data ersetzen</label>";
+        html += "<input type='submit' value='Importieren'>";
+        html += "</form>";
         
-        request->send(200, "text/html; charset=utf-8", htmlWrap("Firmware Update", "/update", html));
+        sendHtml(request, htmlWrap("Firmware Update", "/update", html));
+    });
+
+    // Konfiguration sichern und übertragen (z.B. für viele Geräte auf einmal)
+    // Ohne Passphrase auch per GET (dann ohne Passwörter), mit Passphrase nur per POST:
+    //   curl --data-urlencode "key=$KEY" -o config.txt 'http://<ip>/config/export'
+    server.on("/config/export", HTTP_GET | HTTP_POST, [this](AsyncWebServerRequest *request){
+        String passphrase, error;
+        if (!getConfigKey(request, passphrase, error)) {
+            request->send(400, "text/plain; charset=utf-8", error);
+            return;
+        }
+        String config = exportConfig(passphrase);
+        if (config.length() == 0) {
+            request->send(500, "text/plain", "Export fehlgeschlagen");
+            return;
+        }
+        AsyncWebServerResponse *response = request->beginResponse(200, "text/plain; charset=utf-8", config);
+        response->addHeader("Content-Disposition", "attachment; filename=\"" + getHostname() + "-config.txt\"");
+        response->addHeader("Cache-Control", "no-store");
+        request->send(response);
+    });
+
+    // Import als Datei-Upload (Formular) oder roher Body:
+    //   curl -H 'Content-Type: text/plain' -H "X-Config-Key: $KEY" --data-binary @config.txt 'http://<ip>/config/import'
+    server.on("/config/import", HTTP_POST,
+        [this](AsyncWebServerRequest *request) {
+            handleConfigImport(request);
+        },
+        [this](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
+            appendImportData(request, index, data, len);
+        },
+        [this](AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+            appendImportData(request, index, data, len);
+        }
+    );
+
+    // Captive Portal: Konnektivitäts-Checks von Android, iOS/macOS und Windows
+    const char* probeUrls[] = {
+        "/generate_204", "/gen_204",                            // Android / Chrome
+        "/hotspot-detect.html", "/library/test/success.html",   // iOS / macOS
+        "/connecttest.txt", "/ncsi.txt", "/redirect"            // Windows
+    };
+    for (const char* url : probeUrls) {
+        server.on(url, HTTP_GET, [this](AsyncWebServerRequest *request){
+            handleCaptiveProbe(request);
+        });
+    }
+    server.onNotFound([this](AsyncWebServerRequest *request){
+        handleCaptiveProbe(request);
     });
 
     server.on("/update", HTTP_POST,
-        [](AsyncWebServerRequest *request) { 
-            request->send(200, "text/html; charset=utf-8", 
-                "<!DOCTYPE html><html><head><title>Update</title></head><body>"
-                "<h1>Update abgeschlossen</h1><p>Neustart in 3 Sekunden...</p>"
-                "<script>setTimeout(function(){window.location.href='/';}, 3000);</script>"
-                "</body></html>"); 
+        [this](AsyncWebServerRequest *request) { 
+            sendAssetBody(request, WiFiWebManagerAssets::UPDATE_DONE_HTML);
         },
         [this](AsyncWebServerRequest *request, String filename, size_t index, uint8_t *data, size_t len, bool final) {
             if (!index) {
                 debugPrintf("Update gestartet: %s\n", filename.c_str());
+                otaLastReported = 0;
+                publishEvent(WiFiWebManagerEvent::OtaStarted);
                 if (!Update.begin(UPDATE_SIZE_UNKNOWN)) {
                     if (debugMode) Update.printError(Serial);
                 }
@@ -793,13 +2257,25 @@ void WiFiWebManager::setupWebServer() {
                     if (debugMode) Update.printError(Serial);
                 }
             }
+            // Prozent wie bei ArduinoOTA, gemessen an der Länge des Multipart-Bodys (etwas größer als
+            // die Datei, erreicht also knapp 100). Ohne Content-Length (chunked) kein Fortschritt.
+            size_t total = request->contentLength();
+            if (total > 0) {
+                size_t percent = std::min((index + len) * 100 / total, (size_t)100);
+                if (percent / 10 != otaLastReported / 10) {
+                    otaLastReported = percent;
+                    publishEvent(WiFiWebManagerEvent::OtaProgress, percent);
+                }
+            }
             if (final) {
                 if (Update.end(true)) {
                     debugPrintf("Update erfolgreich: %uB\n", index + len);
-                    delay(1000);
-                    ESP.restart();
+                    publishEvent(WiFiWebManagerEvent::OtaDone, index + len);
+                    // Neustart über loop(), damit Antwort und Ereignisse noch zugestellt werden
+                    shouldReboot = true;
                 } else {
                     if (debugMode) Update.printError(Serial);
+                    publishEvent(WiFiWebManagerEvent::OtaFailed);
                 }
             }
         }
@@ -5,8 +5,17 @@
 #include <Preferences.h>
 #include <ArduinoOTA.h>
 #include <Update.h>
+#include <LittleFS.h>
+#include <ESPmDNS.h>
 #include <vector>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include "WiFiWebManagerForm.h"
+#include "WiFiWebManagerEvents.h"
+#include "WiFiWebManagerNtp.h"
+
+namespace WiFiWebManagerAssets { struct Asset; }
 
 class WiFiWebManager {
 public:
@@ -19,6 +28,35 @@ public:
     void addPage(const String& menutitle, const String& path, ContentHandler getHandler, ContentHandler postHandler = nullptr);
     void removePage(const String& path);
 
+    // Fragmente: einzeln nachladbare Teile einer Seite (Live-Aktualisierung ohne Neuladen)
+    void addFragment(const String& pagePath, const String& name, ContentHandler handler, unsigned long refreshMs = 5000);
+    String renderFragment(AsyncWebServerRequest *request, const String& pagePath, const String& name);
+
+    // Verzögerte Antworten für langsame Seiten (z.B. I2C-Sensoren).
+    // Der Handler startet nur die Arbeit und ruft später complete() auf - aus einem beliebigen Task.
+    // Den AsyncWebServerRequest* nach dem Return des Handlers nicht mehr verwenden!
+    class DeferredResponse {
+    public:
+        void complete(const String& content);
+        bool isPending() const;
+    private:
+        friend class WiFiWebManager;
+        struct State;
+        std::shared_ptr<State> state;
+    };
+    using DeferredHandler = std::function<void(AsyncWebServerRequest*, DeferredResponse)>;
+
+    void addDeferredPage(const String& menutitle, const String& path, DeferredHandler getHandler,
+                         unsigned long timeoutMs = 5000,
+                         const String& fallbackContent = "<p>Zeitüberschreitung - bitte Seite neu laden.</p>");
+
+    // Statische Dateien aus LittleFS (z.B. serveStatic("/static", "/www"))
+    void serveStatic(const String& urlPrefix, const String& fsPath);
+
+    // gzip-Kompression dynamischer Seiten (nur wenn der Client gzip akzeptiert)
+    void setCompression(bool enabled, size_t minSize = 1024);
+    void setPageCompression(const String& path, bool enabled);
+
     // Erweiterte Custom Data API
     void saveCustomData(const String& key, const String& value);
     void saveCustomData(const String& key, int value);
@@ -33,11 +71,32 @@ public:
     bool hasCustomData(const String& key);
     void removeCustomData(const String& key);
     std::vector<String> getCustomDataKeys();
+    void setCustomDataSecret(const String& key);   // Wert wird nur verschlüsselt exportiert
+
+    // Konfiguration (Netzwerk + Custom Data) als Text sichern und auf andere Geräte übertragen.
+    // Geheimnisse (WLAN-Passwort, als geheim markierte Custom Data) nur mit Passphrase, dann verschlüsselt.
+    String exportConfig(const String& passphrase = "");
+    bool importConfig(const String& text, const String& passphrase, String& error, bool replaceCustomData = false);
+
+    // Ereignisse (Verbindung, OTA, Konfiguration, Reset)
+    // Entweder Callbacks registrieren (werden in loop() aufgerufen) ODER selbst mit pollEvent() abholen.
+    using EventCallback = std::function<void(const WiFiWebManagerEventData&)>;
+    void onEvent(EventCallback callback);
+    bool pollEvent(WiFiWebManagerEventData& event);
+    uint32_t getDroppedEvents() const;
+    static const char* getEventName(WiFiWebManagerEvent type);
+
+    // Zeitsynchronisation: Offset, Laufzeit, Drift und Intervall der letzten NTP-Abfrage
+    // (Kopie - aus jedem Task lesbar)
+    WiFiWebManagerNtp::Status getNtpStatus() const;
 
     // Hostname-Management
     void setDefaultHostname(const String& hostname);
     String getHostname();
 
+    // mDNS/DNS-SD: <hostname>.local und Dienst _wifiwebmanager._tcp (Standard: an)
+    void setMDNS(bool enabled);
+
     // Debug-Modus Management
     void setDebugMode(bool enabled);
     bool getDebugMode();
@@ -45,6 +104,8 @@ public:
     void reset();
 
 private:
+    friend class WiFiWebManagerTest;  // Host-Tests in extras/test
+
     ContentHandler rootGetHandler = nullptr;
     ContentHandler rootPostHandler = nullptr;
     
@@ -58,11 +119,24 @@ private:
     bool shouldReboot = false;
 
     bool ntpEnable = false;
-    String ntpServer = "pool.ntp.org";
+    String ntpServer = "pool.ntp.org";   // Auch mehrere, durch Komma getrennt
+    WiFiWebManagerNtp ntp;
 
     // Debug-Modus
     bool debugMode = false;
 
+    // Ereignis-Queue (Produzenten: WLAN/Web/OTA, Konsument: loop() oder pollEvent())
+    static const size_t EVENT_QUEUE_SIZE = 32;
+    WiFiWebManagerEventQueue<WiFiWebManagerEventData, EVENT_QUEUE_SIZE> events;
+    std::vector<EventCallback> eventCallbacks;
+    size_t otaLastReported = 0;             // Zuletzt gemeldeter OTA-Fortschritt in Prozent
+    void publishEvent(WiFiWebManagerEvent type, int32_t value = 0);
+    void dispatchEvents();
+    std::atomic<bool> linkUp{false};        // Letzter gemeldeter Zustand (WLAN-Task)
+    std::atomic<bool> gotIpPending{false};  // GOT_IP gesehen, mDNS/NTP in loop() neu starten
+    bool wifiEventsRegistered = false;
+    void registerWiFiEvents();
+
     // Reset-Button Management
     static const int RESET_PIN = 0;
     static const unsigned long WIFI_RESET_TIME = 3000;  // 3 Sekunden für WLAN-Reset
@@ -75,6 +149,10 @@ private:
     int wifiBootAttempts = 0;
     static const int MAX_BOOT_ATTEMPTS = 3;
 
+    // Doppelt gespeicherter Konfigurationsdatensatz (Slot A/B)
+    uint32_t configSeq = 0;
+    int configSlot = 1;     // Slot mit dem aktuellen Stand; erster Schreibvorgang geht nach A
+
     struct CustomPage {
         String title;
         String path;
@@ -83,18 +161,79 @@ private:
     };
     std::vector<CustomPage> customPages;
 
+    struct Fragment {
+        String page;
+        String name;
+        ContentHandler handler;
+        unsigned long refreshMs;
+    };
+    std::vector<Fragment> fragments;
+    void handleFragment(AsyncWebServerRequest *request);
+
+    // LittleFS / statische Dateien
+    bool fsMounted = false;
+    static const size_t STATIC_CHUNK_SIZE = 1024; // Max. Bytes pro Lesevorgang aus dem Flash
+    void handleStaticFile(AsyncWebServerRequest *request, const String& urlPrefix, const String& fsPath);
+    String getContentType(const String& path);
+
+    // Konfigurations-Import (Upload oder roher Body, max. ein Import gleichzeitig)
+    static const size_t IMPORT_MAX_SIZE = 8192;
+    String importBuffer;
+    AsyncWebServerRequest *importRequest = nullptr;
+    bool importOverflow = false;
+    std::vector<String> secretCustomKeys;
+    void appendImportData(AsyncWebServerRequest *request, size_t index, const uint8_t *data, size_t len);
+    void handleConfigImport(AsyncWebServerRequest *request);
+
+    // Kompression dynamischer Antworten
+    bool compressionEnabled = true;
+    size_t compressionThreshold = 1024;   // Kleinere Antworten lohnen den Aufwand nicht
+    std::vector<String> uncompressedPaths;
+    bool isCompressible(AsyncWebServerRequest *request);
+    void sendHtml(AsyncWebServerRequest *request, String html);
+
     void loadConfig();
-    void saveConfig();
+    void loadLegacyConfig();
+    bool saveConfig();
+    bool readConfigSlot(int slot, uint8_t* buf, uint32_t& seq, size_t& payloadLen);
     void saveNtpConfig(bool ntpEnable, const String& ntpServer);
     void clearAllConfig();
     void clearWiFiConfig();
     
     void startAP();
+
+    // mDNS-Ankündigung (nach jedem Connect neu, damit Hostname und TXT-Records aktuell sind)
+    bool mdnsEnabled = true;
+    bool mdnsRunning = false;
+    void startMDNS();
+    void stopMDNS();
+
+    // Captive Portal: DNS-Responder im AP-Modus (beantwortet jede A-Anfrage mit der AP-Adresse)
+    static const uint16_t DNS_PORT = 53;
+    static const size_t DNS_BUFFER_SIZE = 512;
+    int dnsSocket = -1;
+    uint8_t dnsBuffer[DNS_BUFFER_SIZE];   // Fester Puffer - keine Allokation pro Paket
+    void startDNS();
+    void stopDNS();
+    void processDNS();
+    void handleCaptiveProbe(AsyncWebServerRequest *request);
     bool connectToStoredWiFi();
     String getAvailableSSIDs();
     void setupWebServer();
     bool parseIPString(const String& str, IPAddress& out);
-    void handleNTP();
+    void handleNTP(bool enable, const String& servers);
+
+    // NTP-Änderungen aus Web-Handlern (async_tcp-Task) nur vormerken - der Client läuft in loop()
+    // und wird nur dort umkonfiguriert. Web-Handler und getNtpStatus() lesen eine Kopie des Status.
+    mutable std::mutex ntpLock;
+    bool ntpUpdatePending = false;
+    bool ntpPendingEnable = false;
+    String ntpPendingServer;
+    WiFiWebManagerNtp::Status ntpStatusCopy;
+    void requestNtpUpdate();
+    void applyNtpUpdate();
+    void publishNtpStatus();
+    WiFiWebManagerNtp::Status ntpStatusSnapshot() const;
     void handleResetButton();
     
     void resetBootAttempts();
@@ -109,4 +248,8 @@ private:
 
     String renderMenu(const String& currentPath);
     String htmlWrap(const String& menutitle, const String& currentPath, const String& content);
+    String renderStatusBox();
+    String renderStatusJson();
+    void sendAsset(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset);
+    void sendAssetBody(AsyncWebServerRequest *request, const WiFiWebManagerAssets::Asset& asset);
 };
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+
+// Automatisch erzeugt von extras/build_assets.py - NICHT von Hand bearbeiten!
+// Quellen: extras/web/
+
+#include <Arduino.h>
+
+namespace WiFiWebManagerAssets {
+    struct Asset {
+        const char* path;         // URL oder nullptr (nur intern verwendet)
+        const char* contentType;
+        const uint8_t* data;      // gzip-komprimiert, liegt im Flash
+        size_t length;
+        const char* etag;
+        const uint8_t* rawData;   // minifiziert fuer Clients ohne gzip, sonst nullptr
+        size_t rawLength;
+        const char* rawEtag;
+    };
+
+    // style.css: 1849 Bytes Quelle, 1705 Bytes minifiziert, 710 Bytes gzip (nur gzip im Flash)
+    static const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7d, 0x55, 0xdb, 0x8e, 0x9b, 0x30,
+        0x10, 0xfd, 0x15, 0xa4, 0xa8, 0x52, 0x2b, 0x2d, 0xc8, 0x90, 0x0b, 0xc4, 0xa8, 0x52, 0xff, 0xa3,
+        0xea, 0x83, 0xb1, 0xc7, 0x89, 0xbb, 0x60, 0x23, 0xdb, 0x6c, 0xc8, 0x22, 0xfe, 0xbd, 0xe6, 0x96,
+        0x35, 0x6c, 0xb6, 0x2f, 0x28, 0x31, 0x67, 0x66, 0xce, 0x9c, 0x39, 0x1e, 0x0a, 0xc5, 0xee, 0x5d,
+        0x41, 0xe8, 0xeb, 0x45, 0xab, 0x46, 0x32, 0xbc, 0xe3, 0x7b, 0x7e, 0xe2, 0x24, 0xe7, 0x4a, 0xda,
+        0x90, 0x93, 0x4a, 0x94, 0x77, 0x6c, 0x88, 0x34, 0xa1, 0x01, 0x2d, 0x78, 0x5e, 0x11, 0x7d, 0x11,
+        0x12, 0xa3, 0x3e, 0xa2, 0x20, 0x2d, 0xe8, 0x42, 0xb5, 0x5d, 0x45, 0xda, 0xf0, 0x26, 0x98, 0xbd,
+        0xe2, 0x43, 0x82, 0xea, 0x76, 0xc1, 0x24, 0xd1, 0x11, 0xaa, 0x80, 0x34, 0x56, 0xe5, 0x35, 0x61,
+        0x4c, 0xc8, 0x0b, 0x4e, 0xa0, 0xca, 0x57, 0xb5, 0x38, 0xcf, 0x0b, 0xa5, 0x19, 0xe8, 0x50, 0x13,
+        0x26, 0x1a, 0x83, 0xe3, 0x93, 0x4b, 0xe0, 0x92, 0x86, 0xe6, 0x4a, 0x98, 0xba, 0x61, 0x14, 0xa0,
+        0x20, 0x39, 0xd4, 0x6d, 0xb0, 0x43, 0x08, 0x25, 0x39, 0x13, 0xa6, 0x2e, 0xc9, 0x1d, 0xf3, 0x12,
+        0xda, 0x7c, 0x78, 0x84, 0x4c, 0x68, 0xa0, 0x56, 0x28, 0x89, 0xa9, 0x2a, 0x9b, 0x4a, 0xe6, 0xa4,
+        0x14, 0x17, 0x19, 0x0a, 0x0b, 0x95, 0xc1, 0x13, 0xc7, 0xfe, 0x1a, 0x77, 0x63, 0x3b, 0x46, 0xbc,
+        0x03, 0x8e, 0xa3, 0x93, 0x63, 0x31, 0x71, 0x0c, 0x0b, 0x65, 0xad, 0xaa, 0x70, 0x0c, 0x55, 0x7f,
+        0x4d, 0x56, 0xa0, 0xfd, 0x03, 0xe4, 0xfe, 0x0c, 0x8d, 0xa0, 0xc0, 0xa1, 0x72, 0x57, 0x44, 0x69,
+        0xbc, 0x4b, 0x8e, 0xd9, 0x81, 0xd3, 0xbe, 0x24, 0x05, 0x94, 0xdd, 0x42, 0xaa, 0x28, 0x15, 0x7d,
+        0x7d, 0x04, 0x8d, 0x21, 0x68, 0x08, 0x9d, 0xb4, 0xbc, 0x81, 0xb8, 0x5c, 0x2d, 0x3e, 0x21, 0xd4,
+        0x0b, 0x59, 0x37, 0xf6, 0xc5, 0x40, 0xe9, 0x98, 0x77, 0x93, 0x72, 0x31, 0x42, 0xdf, 0x72, 0xbf,
+        0xfe, 0x50, 0x6c, 0x91, 0x0d, 0x45, 0xd9, 0x33, 0xca, 0x1b, 0xe9, 0xb2, 0x51, 0xb9, 0xe1, 0x04,
+        0xc7, 0x4e, 0x30, 0xa3, 0x4a, 0xc1, 0x82, 0x5d, 0x51, 0x14, 0x93, 0x9e, 0xe2, 0x7d, 0x48, 0x35,
+        0x87, 0xb8, 0x93, 0xbe, 0x68, 0x5c, 0x22, 0xf9, 0x32, 0x92, 0xf9, 0x6d, 0xef, 0x35, 0xfc, 0x34,
+        0x4d, 0x51, 0x09, 0xfb, 0xc7, 0xa7, 0xb4, 0x50, 0x88, 0x97, 0x36, 0x3c, 0x7a, 0x73, 0x31, 0xa9,
+        0x24, 0x3c, 0xa3, 0xe2, 0xcd, 0x79, 0x92, 0x6b, 0x11, 0x6f, 0x98, 0xfa, 0xdc, 0x8c, 0x55, 0xb5,
+        0xeb, 0x2e, 0xdd, 0x68, 0x94, 0x22, 0x94, 0xd3, 0x46, 0x1b, 0x07, 0xae, 0x95, 0x18, 0x46, 0xb8,
+        0xb6, 0xc4, 0xe0, 0x87, 0x6c, 0xf0, 0xc4, 0x94, 0x37, 0x49, 0x72, 0xab, 0x9d, 0x45, 0xc5, 0x68,
+        0x83, 0x8f, 0xba, 0x4e, 0xfd, 0xc4, 0xcc, 0x6d, 0xe2, 0xab, 0x7a, 0x03, 0xfd, 0xa4, 0xd9, 0xe9,
+        0xc5, 0xea, 0x06, 0xc4, 0xe8, 0x74, 0x28, 0x9c, 0xc3, 0x25, 0x79, 0x0b, 0x2b, 0x22, 0xa4, 0xaf,
+        0xc7, 0x66, 0x08, 0xc3, 0x78, 0x27, 0xa0, 0xb1, 0xec, 0x65, 0xfc, 0x41, 0x1b, 0xe3, 0x5e, 0x75,
+        0x9f, 0x9d, 0x7a, 0xd3, 0xa4, 0xc6, 0xc3, 0x23, 0xff, 0xeb, 0x20, 0x82, 0xdf, 0x43, 0xea, 0x7a,
+        0x76, 0x0e, 0x9d, 0x6d, 0x9a, 0x5f, 0xdc, 0xfb, 0x78, 0xc9, 0x37, 0xa7, 0x59, 0xe9, 0x94, 0x78,
+        0xc5, 0x02, 0xe2, 0x97, 0x0b, 0x48, 0x67, 0xa1, 0xb5, 0x21, 0x03, 0xaa, 0x34, 0x19, 0x75, 0x18,
+        0xc7, 0xb2, 0xb2, 0xeb, 0xd6, 0x87, 0x5f, 0xf9, 0x6d, 0xe9, 0x2e, 0x79, 0x18, 0xca, 0x3b, 0x99,
+        0x7d, 0x35, 0x0a, 0x5e, 0x13, 0xed, 0x98, 0xaf, 0xc4, 0x9f, 0xe0, 0x63, 0xd9, 0x49, 0xfe, 0x0f,
+        0xbe, 0xd1, 0x64, 0x78, 0x98, 0x75, 0x1a, 0xcf, 0xe6, 0xb1, 0xac, 0x3a, 0xd9, 0xe0, 0x96, 0xe3,
+        0x65, 0x50, 0x5e, 0x85, 0xc7, 0x3d, 0x8c, 0x8c, 0x25, 0xb6, 0x31, 0x83, 0xad, 0xd7, 0xbb, 0x2c,
+        0xe3, 0x67, 0xb7, 0xcb, 0x3e, 0xdf, 0x0a, 0x38, 0x03, 0x05, 0xfe, 0xc4, 0xb5, 0xbe, 0xdf, 0xfd,
+        0x9b, 0xfc, 0x28, 0xe1, 0x66, 0x26, 0x47, 0x76, 0x5b, 0x26, 0x19, 0x49, 0x0f, 0xc7, 0xf5, 0x76,
+        0x8b, 0x79, 0x06, 0xe7, 0x47, 0x24, 0xa9, 0x37, 0x21, 0x9c, 0xd3, 0x18, 0xa5, 0xdb, 0x85, 0xb8,
+        0xa7, 0xec, 0x11, 0x02, 0x5a, 0xab, 0x6d, 0xcb, 0x8c, 0xee, 0x8f, 0xdb, 0x42, 0x19, 0x4b, 0x19,
+        0xe9, 0x55, 0x3d, 0xcc, 0xc0, 0xc5, 0x2a, 0x0d, 0x2c, 0x94, 0x60, 0x6f, 0x4a, 0xbf, 0x7a, 0x7a,
+        0x2c, 0x19, 0x20, 0x75, 0x3b, 0x9e, 0xaf, 0xdc, 0x50, 0xa8, 0x92, 0xf5, 0xa6, 0x22, 0x65, 0xd9,
+        0xcd, 0xa0, 0x13, 0x4d, 0x8f, 0x29, 0xf3, 0x2c, 0x82, 0xa2, 0xb3, 0xb3, 0xdf, 0xaf, 0x0a, 0x98,
+        0x20, 0xc1, 0xf7, 0x8f, 0x9d, 0xef, 0x8c, 0x54, 0xb7, 0x3f, 0xba, 0xa7, 0xdf, 0x83, 0xf3, 0xf9,
+        0xed, 0xe6, 0x4b, 0xba, 0xdd, 0xc4, 0xff, 0x35, 0xb4, 0x07, 0x74, 0xb0, 0xfe, 0x1f, 0xbf, 0xce,
+        0x64, 0x8f, 0xa9, 0x06, 0x00, 0x00,
+    };
+    static const Asset STYLE_CSS = {"/wwm/style.css", "text/css", STYLE_CSS_GZ, sizeof(STYLE_CSS_GZ), "\"ad6db7034e3e2fcd\"",
+                             nullptr, 0, nullptr};
+
+    // live.js: 1177 Bytes Quelle, 714 Bytes minifiziert, 340 Bytes gzip (nur gzip im Flash)
+    static const uint8_t LIVE_JS_GZ[] PROGMEM = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x92, 0xc1, 0x6e, 0xc2, 0x30,
+        0x0c, 0x86, 0xef, 0x7d, 0x0a, 0xef, 0x42, 0x13, 0x01, 0x55, 0x77, 0xd8, 0x85, 0x0c, 0x4d, 0xdc,
+        0x36, 0x69, 0x3b, 0x8d, 0x1b, 0xe2, 0xd0, 0xb5, 0x2e, 0x8d, 0x16, 0x12, 0x96, 0x3a, 0x68, 0xd3,
+        0xe8, 0xbb, 0x2f, 0x2e, 0x52, 0x07, 0x12, 0x17, 0xc4, 0xa1, 0x4a, 0x1d, 0xfd, 0xfe, 0xfd, 0xd9,
+        0x8e, 0xa8, 0x83, 0x2d, 0x49, 0x3b, 0x0b, 0x42, 0xc2, 0x6f, 0x32, 0x44, 0x3b, 0x67, 0x8c, 0x40,
+        0xc3, 0x77, 0xfb, 0xc2, 0x43, 0xf0, 0x06, 0xe6, 0x80, 0x26, 0xdb, 0x20, 0x2d, 0x88, 0xbc, 0xfe,
+        0x08, 0x84, 0x22, 0xad, 0x0a, 0x2a, 0xa6, 0x46, 0xef, 0x31, 0x95, 0xaa, 0xd7, 0x6d, 0xdb, 0x28,
+        0xdb, 0x15, 0xbe, 0xc5, 0x17, 0x4b, 0xe2, 0xb2, 0xde, 0x63, 0xed, 0xb1, 0x6d, 0x52, 0x39, 0x81,
+        0xfb, 0x5c, 0xc2, 0xe1, 0x00, 0x0f, 0x79, 0x9e, 0xab, 0x44, 0xd7, 0x20, 0x2a, 0x57, 0x86, 0x2d,
+        0x5a, 0xca, 0x1a, 0x5d, 0x55, 0x68, 0xb9, 0x7c, 0x8b, 0xb4, 0xd4, 0x5b, 0x74, 0x81, 0xc4, 0x19,
+        0xeb, 0x80, 0xa8, 0xa0, 0x9b, 0xc4, 0xc2, 0x91, 0xc0, 0x23, 0x05, 0x6f, 0x55, 0xd2, 0x25, 0x35,
+        0x52, 0xd9, 0x88, 0x48, 0x3d, 0x89, 0xc2, 0xb2, 0x28, 0x1b, 0x9c, 0x41, 0x6a, 0xdd, 0xb4, 0xff,
+        0x4d, 0xa1, 0x93, 0x49, 0x46, 0x0d, 0xda, 0x13, 0x47, 0xcf, 0x96, 0x47, 0x03, 0xf0, 0x99, 0xfb,
+        0x84, 0xa7, 0x78, 0x10, 0x7e, 0x53, 0xac, 0x35, 0x03, 0x1b, 0x8c, 0x51, 0x97, 0xd2, 0x88, 0x11,
+        0x99, 0x9c, 0xe0, 0x6e, 0x3e, 0xef, 0x75, 0x30, 0x1a, 0xc1, 0x31, 0x8a, 0xfd, 0x6b, 0x6b, 0xd1,
+        0x3f, 0x2f, 0xdf, 0x5e, 0x59, 0x77, 0x1a, 0xc7, 0x39, 0x11, 0x93, 0xb2, 0x67, 0x59, 0x30, 0xed,
+        0x59, 0x77, 0x17, 0x4a, 0x5d, 0x39, 0x8c, 0x8e, 0xbf, 0x7e, 0x29, 0x68, 0x78, 0x2b, 0xc3, 0x68,
+        0xbf, 0x02, 0xfa, 0x9f, 0x77, 0x34, 0x58, 0x92, 0xf3, 0x8b, 0x98, 0x96, 0xae, 0x86, 0x3d, 0xae,
+        0x79, 0x91, 0xb5, 0xf3, 0x20, 0x38, 0x51, 0xc7, 0xb4, 0x5c, 0xc5, 0xe3, 0x91, 0x3d, 0x32, 0x83,
+        0x76, 0x43, 0x4d, 0x8c, 0xc7, 0x63, 0x66, 0x39, 0x21, 0xf8, 0x7f, 0x28, 0xb7, 0x3c, 0x80, 0xab,
+        0x9a, 0x8b, 0x71, 0xbb, 0xd2, 0x6b, 0x79, 0x9c, 0xa1, 0x90, 0xea, 0x0f, 0x1d, 0x33, 0xf0, 0x34,
+        0xca, 0x02, 0x00, 0x00,
+    };
+    static const Asset LIVE_JS = {"/wwm/live.js", "application/javascript", LIVE_JS_GZ, sizeof(LIVE_JS_GZ), "\"070348723540abd8\"",
+                             nullptr, 0, nullptr};
+
+    // update_done.html: 410 Bytes Quelle, 351 Bytes minifiziert, 270 Bytes gzip
+    static const uint8_t UPDATE_DONE_HTML_GZ[] PROGMEM = {
+        0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x2d, 0x90, 0x41, 0x4f, 0xc3, 0x30,
+        0x0c, 0x85, 0xff, 0x4a, 0x38, 0x65, 0x93, 0xb6, 0x66, 0xd3, 0x8e, 0x4b, 0x72, 0x01, 0xae, 0x80,
+        0xc4, 0x38, 0x70, 0x4c, 0x13, 0x8f, 0x58, 0x4b, 0x93, 0xaa, 0x76, 0x57, 0x26, 0xc4, 0x7f, 0x27,
+        0xac, 0xbd, 0x58, 0x7a, 0x4f, 0xf6, 0x7b, 0x9f, 0xac, 0x1f, 0x9e, 0x5e, 0x1f, 0x4f, 0x9f, 0x6f,
+        0xcf, 0x22, 0x72, 0x97, 0xac, 0x5e, 0x26, 0xb8, 0x60, 0x75, 0x07, 0xec, 0x44, 0x76, 0x1d, 0x18,
+        0x79, 0x45, 0x98, 0xfa, 0x32, 0xb0, 0x14, 0xbe, 0x64, 0x86, 0xcc, 0x46, 0x4e, 0x18, 0x38, 0x9a,
+        0x00, 0x57, 0xf4, 0xb0, 0xbd, 0x8b, 0x8d, 0xc0, 0x8c, 0x8c, 0x2e, 0x6d, 0xc9, 0xbb, 0x04, 0x66,
+        0x2f, 0xad, 0x66, 0xe4, 0x04, 0xf6, 0xa3, 0x0f, 0x8e, 0x41, 0xab, 0x59, 0xe9, 0x84, 0xf9, 0x22,
+        0x06, 0x48, 0x46, 0x12, 0xdf, 0x12, 0x50, 0x04, 0xa8, 0xc9, 0x71, 0x80, 0xb3, 0x91, 0x6a, 0x9a,
+        0x3a, 0x75, 0xb7, 0x1b, 0x4f, 0x54, 0x13, 0xd4, 0x0c, 0xd3, 0x96, 0x70, 0xb3, 0x3a, 0xe0, 0x55,
+        0xf8, 0xe4, 0x88, 0x8c, 0xf4, 0x95, 0x02, 0x86, 0xb6, 0x7c, 0xd7, 0x9d, 0xb8, 0x5f, 0x2a, 0x84,
+        0x6b, 0xbf, 0x80, 0x7c, 0x4c, 0x85, 0x08, 0x72, 0xbd, 0xdd, 0x5b, 0xdd, 0xdb, 0x17, 0x18, 0x89,
+        0xdd, 0xc0, 0x95, 0x4f, 0x1c, 0xc4, 0x3b, 0x5c, 0xc6, 0x1c, 0x20, 0x37, 0x4d, 0xa3, 0x55, 0x5f,
+        0x0b, 0x6a, 0xa8, 0xd5, 0xe4, 0x07, 0xec, 0xd9, 0x12, 0xf0, 0x09, 0x3b, 0x28, 0x23, 0xaf, 0xce,
+        0x63, 0xf6, 0x8c, 0x25, 0xaf, 0xd6, 0x3f, 0x13, 0xe6, 0x50, 0xa6, 0x26, 0x15, 0xef, 0xfe, 0x9d,
+        0x66, 0x41, 0x95, 0xc7, 0xdf, 0x8d, 0x38, 0xec, 0x76, 0xbb, 0xf5, 0x51, 0xab, 0x25, 0x40, 0xab,
+        0x99, 0x54, 0xdd, 0x3f, 0xf9, 0x07, 0xb1, 0xd0, 0x8e, 0x0f, 0x5f, 0x01, 0x00, 0x00,
+    };
+    static const uint8_t UPDATE_DONE_HTML_RAW[] PROGMEM = {
+        0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c,
+        0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x6d, 0x65, 0x74, 0x61,
+        0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x27, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72, 0x74, 0x27,
+        0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x27, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3d,
+        0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x69, 0x6e,
+        0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d, 0x31, 0x27, 0x3e, 0x3c,
+        0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x74, 0x69,
+        0x74, 0x6c, 0x65, 0x3e, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72, 0x65, 0x6c, 0x3d, 0x27, 0x73,
+        0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x27, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3d,
+        0x27, 0x2f, 0x77, 0x77, 0x6d, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x63, 0x73, 0x73, 0x27,
+        0x3e, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x64,
+        0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x27, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72,
+        0x62, 0x6f, 0x78, 0x27, 0x3e, 0x3c, 0x68, 0x31, 0x3e, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20,
+        0x61, 0x62, 0x67, 0x65, 0x73, 0x63, 0x68, 0x6c, 0x6f, 0x73, 0x73, 0x65, 0x6e, 0x3c, 0x2f, 0x68,
+        0x31, 0x3e, 0x3c, 0x70, 0x3e, 0x4e, 0x65, 0x75, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6e,
+        0x20, 0x33, 0x20, 0x53, 0x65, 0x6b, 0x75, 0x6e, 0x64, 0x65, 0x6e, 0x2e, 0x2e, 0x2e, 0x3c, 0x2f,
+        0x70, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e,
+        0x73, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x6f, 0x75, 0x74, 0x28, 0x66, 0x75, 0x6e, 0x63, 0x74,
+        0x69, 0x6f, 0x6e, 0x28, 0x29, 0x7b, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x6c, 0x6f, 0x63,
+        0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x68, 0x72, 0x65, 0x66, 0x3d, 0x27, 0x2f, 0x27, 0x3b, 0x7d,
+        0x2c, 0x20, 0x33, 0x30, 0x30, 0x30, 0x29, 0x3b, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+        0x3e, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e,
+    };
+    static const Asset UPDATE_DONE_HTML = {nullptr, "text/html; charset=utf-8", UPDATE_DONE_HTML_GZ, sizeof(UPDATE_DONE_HTML_GZ), "\"1bd43d0eb00343e4\"",
+                             UPDATE_DONE_HTML_RAW, sizeof(UPDATE_DONE_HTML_RAW), "\"db5f6e6bdd953f8a\""};
+
+    // Alle Assets mit eigener URL, werden in setupWebServer() registriert
+    static const Asset* const STATIC_ASSETS[] = {
+        &STYLE_CSS,
+        &LIVE_JS,
+    };
+}
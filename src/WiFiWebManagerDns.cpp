@@ -0,0 +1,52 @@
+#include "WiFiWebManagerDns.h"
+
+#include <string.h>
+
+namespace WiFiWebManagerDns {
+
+size_t buildResponse(uint8_t* buf, size_t len, size_t capacity, const uint8_t ip[4]) {
+    if (len < 12 || (buf[2] & 0x80)) return 0;  // zu kurz oder selbst eine Antwort
+
+    uint8_t opcode = (buf[2] >> 3) & 0x0F;
+    uint16_t qdcount = (buf[4] << 8) | buf[5];
+    if (opcode != 0 || qdcount != 1) {
+        // Nur Standard-Anfragen mit genau einer Frage: sonst NOTIMP ohne Inhalt
+        buf[2] = 0x80 | (buf[2] & 0x79);
+        buf[3] = 0x84;
+        memset(buf + 4, 0, 8);
+        return 12;
+    }
+
+    size_t pos = 12;
+    while (pos < len && buf[pos] != 0) {
+        if (buf[pos] & 0xC0) return 0;  // Kompression ist in Anfragen nicht zulässig
+        pos += buf[pos] + 1;
+    }
+    if (pos + 5 > len) return 0;
+    pos++;  // abschließendes Null-Label
+    uint16_t qtype = (buf[pos] << 8) | buf[pos + 1];
+    uint16_t qclass = (buf[pos + 2] << 8) | buf[pos + 3];
+    pos += 4;
+
+    // QR=1, AA=1, RD übernehmen, RA=1, RCODE=0; Authority/Additional (z.B. EDNS) entfallen
+    buf[2] = 0x84 | (buf[2] & 0x01);
+    buf[3] = 0x80;
+    memset(buf + 6, 0, 6);
+
+    if ((qtype == 1 || qtype == 255) && qclass == 1 && pos + 16 <= capacity) {
+        static const uint8_t answer[12] = {
+            0xC0, 0x0C,             // Name: Zeiger auf die Frage
+            0x00, 0x01, 0x00, 0x01, // Typ A, Klasse IN
+            0x00, 0x00, 0x00, 0x3C, // TTL 60 s
+            0x00, 0x04              // 4 Bytes Adresse
+        };
+        memcpy(buf + pos, answer, sizeof(answer));
+        memcpy(buf + pos + sizeof(answer), ip, 4);
+        pos += sizeof(answer) + 4;
+        buf[7] = 1;  // ANCOUNT
+    }
+    // Andere Typen (z.B. AAAA): leere Antwort, der Client fragt dann nach A
+    return pos;
+}
+
+}
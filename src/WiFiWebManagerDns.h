@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Captive-Portal-DNS: beantwortet jede A-Anfrage mit einer festen Adresse (der AP-IP).
+// Reine Paketverarbeitung ohne Sockets - läuft so auch auf dem Host (extras/test/dns_test.cpp).
+namespace WiFiWebManagerDns {
+    static const size_t MAX_PACKET = 512;     // klassische UDP-Grenze ohne EDNS
+
+    // Baut die Antwort direkt im Empfangspuffer: Header und Frage bleiben stehen,
+    // dahinter wird (nur für A/ANY-Anfragen) ein A-Record mit 'ip' angehängt.
+    // Rückgabe: Länge der Antwort, 0 = Paket verwerfen.
+    size_t buildResponse(uint8_t* buf, size_t len, size_t capacity, const uint8_t ip[4]);
+}
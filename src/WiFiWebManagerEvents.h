@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Ereignisse, die WiFiWebManager an den Sketch meldet
+enum class WiFiWebManagerEvent : uint8_t {
+    Connected,          // WLAN verbunden (value = RSSI)
+    Disconnected,       // WLAN-Verbindung verloren
+    APFallback,         // Setup-AP gestartet (value = Boot-Versuche)
+    ConfigSaved,        // Netzwerk-Konfiguration gespeichert (value = Sequenznummer)
+    OtaStarted,         // Firmware-Update begonnen
+    OtaProgress,        // Fortschritt in 10-%-Schritten (value = Prozent)
+    OtaDone,            // Update erfolgreich (value = Bytes), Neustart folgt
+    OtaFailed,          // Update fehlgeschlagen
+    ResetRequested      // Reset angefordert (value: 0 = nur WLAN, 1 = Werks-Reset)
+};
+
+struct WiFiWebManagerEventData {
+    WiFiWebManagerEvent type;
+    int32_t value;
+    uint32_t timestamp;     // millis() beim Auslösen
+};
+
+// Begrenzte, lock-freie MPSC-Queue (nach D. Vyukov):
+// beliebig viele Produzenten (WLAN-, Web-, OTA-Kontext), genau ein Konsument.
+// push() blockiert nie und allokiert nichts - ist die Queue voll, wird das Ereignis
+// verworfen und der Überlaufzähler erhöht.
+template <typename T, size_t Capacity>
+class WiFiWebManagerEventQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity muss eine Zweierpotenz sein");
+
+public:
+    WiFiWebManagerEventQueue() {
+        for (size_t i = 0; i < Capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool push(const T& item) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells[pos & (Capacity - 1)];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                overflowCount.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Nur aus einem einzigen Task aufrufen
+    bool pop(T& item) {
+        Cell& cell = cells[dequeuePos & (Capacity - 1)];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        if ((intptr_t)seq - (intptr_t)(dequeuePos + 1) < 0) return false;
+        item = cell.data;
+        cell.sequence.store(dequeuePos + Capacity, std::memory_order_release);
+        dequeuePos++;
+        return true;
+    }
+
+    uint32_t overflows() const {
+        return overflowCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    Cell cells[Capacity];
+    std::atomic<size_t> enqueuePos{0};
+    std::atomic<uint32_t> overflowCount{0};
+    size_t dequeuePos = 0;
+};
@@ -0,0 +1,189 @@
+#include "WiFiWebManagerForm.h"
+
+#include <limits.h>
+#include <strings.h>
+
+FormBinder& FormBinder::add(const char* name, Type type, void* target, bool required,
+                            long minValue, long maxValue, size_t maxLength) {
+    bindings.push_back({name, type, target, minValue, maxValue, maxLength, required, false});
+    return *this;
+}
+
+FormBinder& FormBinder::bind(const char* name, String& target, size_t maxLength, bool required) {
+    return add(name, Type::Text, &target, required, 0, 0, maxLength);
+}
+
+FormBinder& FormBinder::bind(const char* name, int& target, long minValue, long maxValue, bool required) {
+    return add(name, Type::Integer, &target, required, minValue, maxValue);
+}
+
+FormBinder& FormBinder::bindBool(const char* name, bool& target, bool required) {
+    return add(name, Type::Boolean, &target, required);
+}
+
+FormBinder& FormBinder::bindCheckbox(const char* name, bool& target) {
+    return add(name, Type::Checkbox, &target, false);
+}
+
+FormBinder& FormBinder::bindIP(const char* name, IPAddress& target, bool required) {
+    return add(name, Type::Address, &target, required);
+}
+
+FormBinder& FormBinder::bindIP(const char* name, String& target, bool required) {
+    return add(name, Type::AddressText, &target, required);
+}
+
+bool FormBinder::parse(AsyncWebServerRequest *request) {
+    // Ein Durchlauf über alle Parameter; pro Parameter ein Vergleich je Binding
+    size_t count = request->params();
+    for (size_t i = 0; i < count; i++) {
+        const AsyncWebParameter* param = request->getParam(i);
+        if (!param->isPost() || param->isFile()) continue;
+        const char* name = param->name().c_str();
+        for (auto& binding : bindings) {
+            if (!binding.seen && strcmp(binding.name, name) == 0) {
+                binding.seen = true;
+                apply(binding, param->value());
+                break;
+            }
+        }
+    }
+
+    for (auto& binding : bindings) {
+        if (binding.seen) continue;
+        if (binding.type == Type::Checkbox) {
+            *static_cast<bool*>(binding.target) = false;
+        } else if (binding.required) {
+            addError(String("Feld '") + binding.name + "' fehlt");
+        }
+    }
+    return !hasErrors();
+}
+
+void FormBinder::apply(Binding& binding, const String& value) {
+    const char* str = value.c_str();
+
+    if (value.length() == 0 && binding.type != Type::Text && binding.type != Type::Checkbox) {
+        // Leere Eingabe bei typisierten Feldern: nur bei Pflichtfeldern ein Fehler
+        if (binding.required) addError(String("Feld '") + binding.name + "' darf nicht leer sein");
+        else if (binding.type == Type::AddressText) *static_cast<String*>(binding.target) = "";
+        return;
+    }
+
+    switch (binding.type) {
+        case Type::Text:
+            if (binding.required && value.length() == 0) {
+                addError(String("Feld '") + binding.name + "' darf nicht leer sein");
+            } else if (binding.maxLength > 0 && value.length() > binding.maxLength) {
+                addError(String("Feld '") + binding.name + "' ist zu lang (max. " + String((unsigned long)binding.maxLength) + " Zeichen)");
+            } else {
+                *static_cast<String*>(binding.target) = value;
+            }
+            break;
+
+        case Type::Integer: {
+            long v;
+            if (!parseInt(str, v)) {
+                addError(String("Feld '") + binding.name + "': keine gültige Zahl");
+            } else if (v < binding.minValue || v > binding.maxValue) {
+                addError(String("Feld '") + binding.name + "': Wert muss zwischen " + String(binding.minValue) +
+                         " und " + String(binding.maxValue) + " liegen");
+            } else {
+                *static_cast<int*>(binding.target) = (int)v;
+            }
+            break;
+        }
+
+        case Type::Boolean: {
+            bool v;
+            if (parseBool(str, v)) *static_cast<bool*>(binding.target) = v;
+            else addError(String("Feld '") + binding.name + "': ungültiger Wahrheitswert");
+            break;
+        }
+
+        case Type::Checkbox:
+            *static_cast<bool*>(binding.target) = true;
+            break;
+
+        case Type::Address:
+        case Type::AddressText: {
+            uint8_t octets[4];
+            if (!parseIPv4(str, octets)) {
+                addError(String("Feld '") + binding.name + "': ungültige IP-Adresse");
+            } else if (binding.type == Type::Address) {
+                *static_cast<IPAddress*>(binding.target) = IPAddress(octets[0], octets[1], octets[2], octets[3]);
+            } else {
+                *static_cast<String*>(binding.target) = value;
+            }
+            break;
+        }
+    }
+}
+
+void FormBinder::addError(const String& message) {
+    errorList.push_back(message);
+}
+
+String FormBinder::errorHtml() const {
+    String html = "<div class='status-box status-error'><strong>Ungültige Eingaben:</strong><ul>";
+    for (const auto& e : errorList) {
+        html += "<li>" + e + "</li>";
+    }
+    html += "</ul></div>";
+    return html;
+}
+
+bool FormBinder::parseIPv4(const char* str, uint8_t out[4]) {
+    if (!str) return false;
+    for (int octet = 0; octet < 4; octet++) {
+        unsigned value = 0;
+        int digits = 0;
+        while (*str >= '0' && *str <= '9') {
+            value = value * 10 + (*str - '0');
+            if (++digits > 3 || value > 255) return false;
+            str++;
+        }
+        if (digits == 0) return false;
+        out[octet] = (uint8_t)value;
+        if (octet < 3) {
+            if (*str != '.') return false;
+            str++;
+        }
+    }
+    return *str == '\0';
+}
+
+bool FormBinder::parseInt(const char* str, long& out) {
+    if (!str) return false;
+    bool negative = false;
+    if (*str == '-') {
+        negative = true;
+        str++;
+    }
+    if (*str == '\0') return false;
+
+    // Betrag als unsigned sammeln, damit LONG_MIN darstellbar bleibt
+    unsigned long limit = negative ? (unsigned long)LONG_MAX + 1 : (unsigned long)LONG_MAX;
+    unsigned long value = 0;
+    for (; *str; str++) {
+        if (*str < '0' || *str > '9') return false;
+        unsigned digit = *str - '0';
+        if (value > (limit - digit) / 10) return false;
+        value = value * 10 + digit;
+    }
+    out = negative ? (long)(0 - value) : (long)value;
+    return true;
+}
+
+bool FormBinder::parseBool(const char* str, bool& out) {
+    if (!str) return false;
+    static const char* const trueValues[] = {"1", "true", "on", "yes"};
+    static const char* const falseValues[] = {"0", "false", "off", "no"};
+    for (const char* t : trueValues) {
+        if (strcasecmp(str, t) == 0) { out = true; return true; }
+    }
+    for (const char* f : falseValues) {
+        if (strcasecmp(str, f) == 0) { out = false; return true; }
+    }
+    return false;
+}
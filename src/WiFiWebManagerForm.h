@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <vector>
+
+// Deklaratives Einlesen von POST-Formularen:
+// Ziele werden vorab registriert, parse() läuft genau einmal über alle Parameter
+// und sammelt Validierungsfehler. Fehlt ein (optionales) Feld, bleibt das Ziel unverändert.
+//
+//   FormBinder form;
+//   form.bind("name", name, 32, true)
+//       .bind("interval", interval, 100, 60000)
+//       .bindIP("ip", ip)
+//       .bindCheckbox("enabled", enabled);
+//   if (!form.parse(request)) return form.errorHtml();
+class FormBinder {
+public:
+    FormBinder& bind(const char* name, String& target, size_t maxLength = 0, bool required = false);
+    FormBinder& bind(const char* name, int& target, long minValue, long maxValue, bool required = false);
+    FormBinder& bindBool(const char* name, bool& target, bool required = false);
+    FormBinder& bindCheckbox(const char* name, bool& target);   // vorhanden = true, fehlt = false
+    FormBinder& bindIP(const char* name, IPAddress& target, bool required = false);
+    FormBinder& bindIP(const char* name, String& target, bool required = false);   // geprüft, als Text gespeichert
+
+    bool parse(AsyncWebServerRequest *request);   // true, wenn keine Fehler
+
+    void addError(const String& message);
+    bool hasErrors() const { return !errorList.empty(); }
+    const std::vector<String>& errors() const { return errorList; }
+    String errorHtml() const;
+
+    // Schnelle, strikte Parser (ohne sscanf/strtol) - auch einzeln nutzbar
+    static bool parseIPv4(const char* str, uint8_t out[4]);   // genau 4 Oktette 0..255
+    static bool parseInt(const char* str, long& out);         // optionales '-', nur Ziffern, mit Überlaufprüfung
+    static bool parseBool(const char* str, bool& out);        // 1/0, true/false, on/off, yes/no
+
+private:
+    enum class Type : uint8_t { Text, Integer, Boolean, Checkbox, Address, AddressText };
+
+    struct Binding {
+        const char* name;
+        Type type;
+        void* target;
+        long minValue;
+        long maxValue;
+        size_t maxLength;
+        bool required;
+        bool seen;
+    };
+
+    std::vector<Binding> bindings;
+    std::vector<String> errorList;
+
+    FormBinder& add(const char* name, Type type, void* target, bool required,
+                    long minValue = 0, long maxValue = 0, size_t maxLength = 0);
+    void apply(Binding& binding, const String& value);
+};
@@ -0,0 +1,223 @@
+#include "WiFiWebManagerGzip.h"
+
+#include <new>
+#include <string.h>
+
+namespace WiFiWebManagerGzip {
+
+namespace {
+    const int MIN_MATCH = 3;
+    const int MAX_MATCH = 258;
+    const size_t HASH_SIZE = 1u << HASH_BITS;
+
+    const uint16_t LENGTH_BASE[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    const uint8_t LENGTH_EXTRA[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+    };
+    const uint16_t DIST_BASE[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+    };
+    const uint8_t DIST_EXTRA[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    inline uint32_t hash3(const uint8_t* p) {
+        uint32_t v = (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+        return (v * 2654435761u) >> (32 - HASH_BITS);
+    }
+
+    // Nach so vielen Bytes Ausgabe gibt step() an read() zurück
+    const size_t STEP_OUTPUT = 64;
+}
+
+uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len) {
+    // Bitweise Variante ohne Tabelle - spart 1 KB Flash, Durchsatz reicht für Webseiten
+    crc = ~crc;
+    while (len--) {
+        crc ^= *data++;
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+    }
+    return ~crc;
+}
+
+Deflater::Deflater(const uint8_t* data, size_t len) : data(data), len(len) {}
+
+Deflater::~Deflater() {
+    release();
+}
+
+bool Deflater::begin() {
+    // head: letzte Position je Hash, prev: Vorgänger innerhalb des Fensters (-1 = keiner)
+    head = new (std::nothrow) int32_t[HASH_SIZE];
+    prev = new (std::nothrow) int32_t[WINDOW_SIZE];
+    if (!head || !prev) {
+        release();
+        return false;
+    }
+    for (size_t i = 0; i < HASH_SIZE; i++) head[i] = -1;
+    pending.reserve(STEP_OUTPUT + 16);
+    return true;
+}
+
+void Deflater::release() {
+    delete[] head;
+    delete[] prev;
+    head = nullptr;
+    prev = nullptr;
+}
+
+size_t Deflater::read(uint8_t* buf, size_t maxLen) {
+    size_t n = 0;
+    while (n < maxLen) {
+        if (pendingPos < pending.size()) {
+            size_t chunk = pending.size() - pendingPos;
+            if (chunk > maxLen - n) chunk = maxLen - n;
+            memcpy(buf + n, pending.data() + pendingPos, chunk);
+            pendingPos += chunk;
+            n += chunk;
+            continue;
+        }
+        pending.clear();
+        pendingPos = 0;
+        if (stage == Stage::Done) break;
+        step();
+    }
+    produced += n;
+    return n;
+}
+
+void Deflater::step() {
+    if (stage == Stage::Header) {
+        if (!head) {
+            stage = Stage::Done;   // begin() fehlgeschlagen oder nicht aufgerufen
+            return;
+        }
+        static const uint8_t GZIP_HEADER[10] = {0x1f, 0x8b, 0x08, 0x00, 0, 0, 0, 0, 0x00, 0xff};
+        pending.insert(pending.end(), GZIP_HEADER, GZIP_HEADER + sizeof(GZIP_HEADER));
+        putBits(1, 1); // BFINAL
+        putBits(1, 2); // BTYPE = 01 (feste Huffman-Codes)
+        stage = Stage::Body;
+        return;
+    }
+
+    size_t startPos = pos;
+    while (pos < len && pending.size() < STEP_OUTPUT) {
+        int bestLen = 0;
+        int bestDist = 0;
+
+        if (pos + MIN_MATCH <= len) {
+            size_t maxLen = len - pos < (size_t)MAX_MATCH ? len - pos : (size_t)MAX_MATCH;
+            int32_t cand = head[hash3(data + pos)];
+            for (int chain = 0; cand >= 0 && chain < MAX_CHAIN; chain++) {
+                size_t dist = pos - (size_t)cand;
+                if (dist > WINDOW_SIZE - 1) break;
+                if (data[cand + bestLen] == data[pos + bestLen]) {
+                    size_t l = 0;
+                    while (l < maxLen && data[cand + l] == data[pos + l]) l++;
+                    if ((int)l > bestLen) {
+                        bestLen = (int)l;
+                        bestDist = (int)dist;
+                        if (l == maxLen) break;
+                    }
+                }
+                int32_t next = prev[cand & (WINDOW_SIZE - 1)];
+                if (next >= cand) break; // Eintrag wurde im Ringpuffer überschrieben
+                cand = next;
+            }
+        }
+
+        if (bestLen >= MIN_MATCH) {
+            putMatch(bestLen, bestDist);
+            size_t stop = pos + bestLen;
+            for (; pos < stop; pos++) {
+                if (pos + MIN_MATCH <= len) insert(pos);
+            }
+        } else {
+            putSymbol(data[pos]);
+            if (pos + MIN_MATCH <= len) insert(pos);
+            pos++;
+        }
+    }
+    crc = crc32(crc, data + startPos, pos - startPos);
+
+    if (pos >= len) {
+        putSymbol(256); // Blockende
+        if (bitCount > 0) pending.push_back(bitBuf & 0xFF);
+        bitBuf = 0;
+        bitCount = 0;
+        putLE32(crc);
+        putLE32((uint32_t)len);
+        release();
+        stage = Stage::Done;
+    }
+}
+
+void Deflater::insert(size_t p) {
+    uint32_t h = hash3(data + p);
+    prev[p & (WINDOW_SIZE - 1)] = head[h];
+    head[h] = (int32_t)p;
+}
+
+// Deflate schreibt Bits LSB-first, Huffman-Codes aber MSB-first
+void Deflater::putBits(uint32_t bits, int count) {
+    bitBuf |= bits << bitCount;
+    bitCount += count;
+    while (bitCount >= 8) {
+        pending.push_back(bitBuf & 0xFF);
+        bitBuf >>= 8;
+        bitCount -= 8;
+    }
+}
+
+void Deflater::putCode(uint32_t code, int count) {
+    uint32_t reversed = 0;
+    for (int i = 0; i < count; i++) {
+        reversed = (reversed << 1) | (code & 1);
+        code >>= 1;
+    }
+    putBits(reversed, count);
+}
+
+// Feste Huffman-Codes aus RFC 1951, Abschnitt 3.2.6
+void Deflater::putSymbol(int sym) {
+    if (sym < 144)      putCode(0x30 + sym, 8);
+    else if (sym < 256) putCode(0x190 + (sym - 144), 9);
+    else if (sym < 280) putCode(sym - 256, 7);
+    else                putCode(0xC0 + (sym - 280), 8);
+}
+
+void Deflater::putMatch(int length, int distance) {
+    int lc = 28;
+    while (LENGTH_BASE[lc] > length) lc--;
+    putSymbol(257 + lc);
+    if (LENGTH_EXTRA[lc]) putBits(length - LENGTH_BASE[lc], LENGTH_EXTRA[lc]);
+
+    int dc = 29;
+    while (DIST_BASE[dc] > distance) dc--;
+    putCode(dc, 5);
+    if (DIST_EXTRA[dc]) putBits(distance - DIST_BASE[dc], DIST_EXTRA[dc]);
+}
+
+void Deflater::putLE32(uint32_t v) {
+    for (int i = 0; i < 4; i++) pending.push_back((v >> (8 * i)) & 0xFF);
+}
+
+bool compress(const uint8_t* data, size_t len, std::vector<uint8_t>& out) {
+    Deflater deflater(data, len);
+    if (!deflater.begin()) return false;
+    out.reserve(out.size() + len / 3 + 32);
+    uint8_t buf[256];
+    size_t n;
+    while ((n = deflater.read(buf, sizeof(buf))) > 0) {
+        out.insert(out.end(), buf, buf + n);
+    }
+    return true;
+}
+
+}
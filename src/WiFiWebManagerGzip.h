@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+// Kleiner gzip-Kompressor für dynamische Antworten.
+// LZ77 mit kleinem Fenster + feste Huffman-Codes (Deflate-Blocktyp 1):
+// deutlich schwächer als zlib, braucht aber nur ~12 KB RAM während der Kompression
+// und kommt ohne dynamische Huffman-Tabellen aus.
+// Deflater arbeitet inkrementell: jeder read()-Aufruf erzeugt nur so viel Ausgabe, wie in den
+// Puffer des Aufrufers passt - der komprimierte Stream liegt nie komplett im RAM.
+namespace WiFiWebManagerGzip {
+    static const size_t WINDOW_SIZE = 2048;   // Max. Rückwärtsdistanz (Zweierpotenz)
+    static const int HASH_BITS = 10;          // 1024 Hash-Ketten
+    static const int MAX_CHAIN = 16;          // Max. geprüfte Kandidaten pro Position
+
+    // CRC-32 (IEEE 802.3), fortsetzbar: crc32(crc32(0, a, n), b, m)
+    uint32_t crc32(uint32_t crc, const uint8_t* data, size_t len);
+
+    class Deflater {
+    public:
+        // data muss gültig bleiben, bis read() 0 liefert
+        Deflater(const uint8_t* data, size_t len);
+        ~Deflater();
+        Deflater(const Deflater&) = delete;
+        Deflater& operator=(const Deflater&) = delete;
+
+        // Legt die Hash-Tabellen an; false, wenn dafür kein Speicher frei ist
+        bool begin();
+        // Schreibt die nächsten (höchstens maxLen) Bytes des gzip-Streams; 0 = fertig.
+        // Die Hash-Tabellen werden freigegeben, sobald die Eingabe verarbeitet ist.
+        size_t read(uint8_t* buf, size_t maxLen);
+        bool finished() const { return stage == Stage::Done && pendingPos >= pending.size(); }
+        size_t totalOut() const { return produced; }
+
+    private:
+        enum class Stage { Header, Body, Done };
+
+        const uint8_t* data;
+        size_t len;
+        size_t pos = 0;
+        uint32_t crc = 0;
+        int32_t* head = nullptr;
+        int32_t* prev = nullptr;
+        Stage stage = Stage::Header;
+
+        // Bereits codierte, noch nicht abgeholte Bytes (höchstens ein Block + Rest)
+        std::vector<uint8_t> pending;
+        size_t pendingPos = 0;
+        uint32_t bitBuf = 0;
+        int bitCount = 0;
+        size_t produced = 0;
+
+        void step();
+        void insert(size_t p);
+        void putBits(uint32_t bits, int count);
+        void putCode(uint32_t code, int count);
+        void putSymbol(int sym);
+        void putMatch(int length, int distance);
+        void putLE32(uint32_t v);
+        void release();
+    };
+
+    // Komprimiert data als vollständigen gzip-Stream nach out (wird angehängt).
+    // Gibt false zurück, wenn kein Speicher für die Hash-Tabellen verfügbar ist.
+    bool compress(const uint8_t* data, size_t len, std::vector<uint8_t>& out);
+}
@@ -0,0 +1,296 @@
+#include "WiFiWebManagerNtp.h"
+#include "WiFiWebManagerForm.h"
+
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include <math.h>
+#include <stdlib.h>
+#include <sys/time.h>
+
+// Sekunden zwischen NTP-Epoche (1900) und Unix-Epoche (1970)
+static const int64_t NTP_UNIX_OFFSET = 2208988800LL;
+
+WiFiWebManagerNtp::~WiFiWebManagerNtp() {
+    stop();
+}
+
+void WiFiWebManagerNtp::setServers(const String& list) {
+    std::vector<Server> parsed;
+    int start = 0;
+    while (start <= (int)list.length()) {
+        int end = list.indexOf(',', start);
+        if (end < 0) end = list.length();
+        String entry = list.substring(start, end);
+        entry.trim();
+        if (entry.length() > 0) {
+            Server server = {entry, NTP_PORT, 0};
+            int colon = entry.lastIndexOf(':');
+            if (colon > 0) {
+                long port;
+                if (FormBinder::parseInt(entry.substring(colon + 1).c_str(), port) && port > 0 && port <= 65535) {
+                    server.host = entry.substring(0, colon);
+                    server.port = (uint16_t)port;
+                }
+            }
+            parsed.push_back(server);
+        }
+        start = end + 1;
+    }
+
+    bool changed = parsed.size() != servers.size();
+    for (size_t i = 0; !changed && i < parsed.size(); i++) {
+        changed = parsed[i].host != servers[i].host || parsed[i].port != servers[i].port;
+    }
+    if (!changed) return;
+
+    servers = parsed;
+    serverIndex = 0;
+    failuresInRow = 0;
+    waiting = false;
+    schedule(0);
+}
+
+bool WiFiWebManagerNtp::begin() {
+    if (sock >= 0) return true;
+    sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) {
+        state.lastError = "Socket konnte nicht angelegt werden";
+        return false;
+    }
+    // Nach dem Start sofort und mit kurzem Intervall synchronisieren
+    pollExp = 6;
+    stableCount = 0;
+    failuresInRow = 0;
+    waiting = false;
+    schedule(0);
+    return true;
+}
+
+void WiFiWebManagerNtp::stop() {
+    if (sock < 0) return;
+    close(sock);
+    sock = -1;
+    waiting = false;
+}
+
+void WiFiWebManagerNtp::syncNow() {
+    if (!waiting) schedule(0);
+}
+
+void WiFiWebManagerNtp::loop() {
+    if (sock < 0 || servers.empty()) return;
+
+    if (waiting) {
+        receiveResponse();
+        if (waiting && millis() - sentMillis >= RESPONSE_TIMEOUT_MS) {
+            handleFailure("Zeitüberschreitung");
+        }
+        return;
+    }
+    if (millis() - scheduledAt >= pollDelayMs) {
+        sendRequest();
+    }
+}
+
+void WiFiWebManagerNtp::schedule(unsigned long delayMs) {
+    scheduledAt = millis();
+    pollDelayMs = delayMs;
+}
+
+void WiFiWebManagerNtp::sendRequest() {
+    Server& server = servers[serverIndex];
+    if (server.address == 0) {
+        // Blockiert loop() bis zur Antwort bzw. zum DNS-Timeout - nur beim ersten Mal und nach
+        // Fehlern, danach wird die Adresse wiederverwendet
+        IPAddress resolved;
+        if (!WiFi.hostByName(server.host.c_str(), resolved) || (uint32_t)resolved == 0) {
+            handleFailure("DNS-Auflösung fehlgeschlagen");
+            return;
+        }
+        server.address = (uint32_t)resolved;
+    }
+
+    // Verspätete Antworten einer abgebrochenen Anfrage verwerfen
+    uint8_t packet[PACKET_SIZE];
+    while (recvfrom(sock, packet, sizeof(packet), MSG_DONTWAIT, nullptr, nullptr) > 0) {}
+
+    memset(packet, 0, sizeof(packet));
+    packet[0] = 0x23;   // LI = 0, Version 4, Modus 3 (Client)
+    sentUs = nowUs();
+    toNtp(sentUs, packet + 40);
+    // Die untersten Bits liegen unter der Mikrosekunden-Auflösung: mit Zufall füllen,
+    // damit gefälschte Antworten den Originate-Timestamp nicht erraten können
+    uint32_t noise = esp_random() & 0x0FFF;
+    packet[46] ^= noise >> 8;
+    packet[47] ^= noise & 0xFF;
+    memcpy(sentStamp, packet + 40, sizeof(sentStamp));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(server.port);
+    addr.sin_addr.s_addr = server.address;
+    if (sendto(sock, packet, sizeof(packet), 0, (struct sockaddr*)&addr, sizeof(addr)) != (int)sizeof(packet)) {
+        handleFailure("Senden fehlgeschlagen");
+        return;
+    }
+    sentMillis = millis();
+    waiting = true;
+}
+
+void WiFiWebManagerNtp::receiveResponse() {
+    const Server& server = servers[serverIndex];
+    uint8_t packet[PACKET_SIZE];
+
+    for (int i = 0; i < 4; i++) {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int len = recvfrom(sock, packet, sizeof(packet), MSG_DONTWAIT, (struct sockaddr*)&from, &fromLen);
+        if (len <= 0) return;
+        int64_t receivedUs = nowUs();   // T4
+
+        // Fremde oder veraltete Pakete ignorieren, Anfrage bleibt offen
+        if (len < (int)PACKET_SIZE || from.sin_addr.s_addr != server.address || from.sin_port != htons(server.port)) continue;
+        if (memcmp(packet + 24, sentStamp, sizeof(sentStamp)) != 0) continue;
+
+        uint8_t leap = packet[0] >> 6;
+        uint8_t mode = packet[0] & 0x07;
+        uint8_t stratum = packet[1];
+        if (mode != 4) continue;
+        if (stratum == 0) {
+            handleFailure("Kiss-o'-Death vom Server");
+            return;
+        }
+        if (leap == 3 || stratum > 15) {
+            handleFailure("Server nicht synchronisiert");
+            return;
+        }
+
+        int64_t serverReceiveUs = fromNtp(packet + 32);    // T2
+        int64_t serverTransmitUs = fromNtp(packet + 40);   // T3
+        int64_t offsetUs = ((serverReceiveUs - sentUs) + (serverTransmitUs - receivedUs)) / 2;
+        int64_t delayUs = (receivedUs - sentUs) - (serverTransmitUs - serverReceiveUs);
+        if (delayUs < 0) delayUs = 0;
+
+        waiting = false;
+        failuresInRow = 0;
+        applySample(offsetUs, delayUs, stratum);
+        return;
+    }
+}
+
+void WiFiWebManagerNtp::handleFailure(const char* reason) {
+    waiting = false;
+    state.failCount++;
+    state.lastError = reason;
+
+    // Adresse neu auflösen (Pools liefern dann einen anderen Server) und zum nächsten Eintrag wechseln
+    servers[serverIndex].address = 0;
+    serverIndex = (serverIndex + 1) % servers.size();
+    failuresInRow++;
+    if (failuresInRow < servers.size()) {
+        schedule(1000);
+    } else {
+        failuresInRow = 0;
+        schedule(MIN_POLL_S * 1000UL);
+    }
+}
+
+void WiFiWebManagerNtp::applySample(int64_t offsetUs, int64_t delayUs, uint8_t stratum) {
+    int64_t now = nowUs();
+
+    if (!state.synced || llabs(offsetUs) > STEP_THRESHOLD_US) {
+        // Große Abweichung (oder erste Synchronisation): Uhr stellen und schnell nachprüfen
+        int64_t corrected = now + offsetUs;
+        struct timeval tv;
+        tv.tv_sec = corrected / 1000000;
+        tv.tv_usec = corrected % 1000000;
+        settimeofday(&tv, nullptr);
+        if (state.synced) state.stepCount++;
+        pollExp = 6;
+        stableCount = 0;
+        lastCorrectionUs = corrected;
+    } else {
+        // Drift: Abweichung seit der letzten Korrektur geteilt durch die verstrichene Zeit (µs/s = ppm)
+        if (lastCorrectionUs > 0 && now - lastCorrectionUs >= 16000000LL) {
+            float sample = -(float)offsetUs / ((now - lastCorrectionUs) / 1000000.0f);
+            state.driftPpm = driftValid ? state.driftPpm + (sample - state.driftPpm) / 4 : sample;
+            driftValid = true;
+        }
+
+        // Kleine Abweichung: sanft nachführen, die Uhr springt nie zurück
+        struct timeval delta;
+        delta.tv_sec = offsetUs / 1000000;
+        delta.tv_usec = offsetUs % 1000000;
+        if (delta.tv_usec < 0) {
+            delta.tv_sec -= 1;
+            delta.tv_usec += 1000000;
+        }
+        adjtime(&delta, nullptr);
+        lastCorrectionUs = now;
+
+        // Stabil: Intervall nach zwei guten Messungen verdoppeln, sonst halbieren
+        if (llabs(offsetUs) < STABLE_OFFSET_US) {
+            if (++stableCount >= 2 && pollExp < 12) {
+                pollExp++;
+                stableCount = 0;
+            }
+        } else {
+            stableCount = 0;
+            if (pollExp > 6) pollExp--;
+        }
+    }
+
+    state.synced = true;
+    state.server = servers[serverIndex].host;
+    state.stratum = stratum;
+    state.offsetUs = offsetUs;
+    state.delayUs = (uint32_t)delayUs;
+    state.lastSyncMillis = millis();
+    state.syncCount++;
+    state.lastError = "";
+    state.pollIntervalS = pollInterval();
+    schedule(state.pollIntervalS * 1000UL);
+}
+
+uint32_t WiFiWebManagerNtp::pollInterval() const {
+    uint32_t interval = 1UL << pollExp;
+    // Bekannte Drift begrenzt das Intervall: bis zur nächsten Abfrage höchstens STABLE_OFFSET_US Abweichung
+    float drift = fabsf(state.driftPpm);
+    if (driftValid && drift > 1.0f) {
+        uint32_t limit = (uint32_t)(STABLE_OFFSET_US / drift);
+        if (limit < MIN_POLL_S) limit = MIN_POLL_S;
+        if (limit < interval) interval = limit;
+    }
+    return interval;
+}
+
+int64_t WiFiWebManagerNtp::nowUs() {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+int64_t WiFiWebManagerNtp::fromNtp(const uint8_t* p) {
+    uint32_t seconds = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    uint32_t fraction = (uint32_t)p[4] << 24 | (uint32_t)p[5] << 16 | (uint32_t)p[6] << 8 | p[7];
+    // Ära-Wechsel 2036: Werte mit gelöschtem höchsten Bit gehören zur nächsten Ära
+    int64_t unixSeconds = (int64_t)seconds - NTP_UNIX_OFFSET;
+    if (!(seconds & 0x80000000u)) unixSeconds += 0x100000000LL;
+    return unixSeconds * 1000000 + (int64_t)(((uint64_t)fraction * 1000000) >> 32);
+}
+
+void WiFiWebManagerNtp::toNtp(int64_t us, uint8_t* p) {
+    int64_t unixSeconds = us / 1000000;
+    int64_t micros = us % 1000000;
+    if (micros < 0) {
+        unixSeconds -= 1;
+        micros += 1000000;
+    }
+    uint32_t seconds = (uint32_t)(unixSeconds + NTP_UNIX_OFFSET);
+    uint32_t fraction = (uint32_t)(((uint64_t)micros << 32) / 1000000);
+    for (int i = 0; i < 4; i++) {
+        p[i] = seconds >> (24 - 8 * i);
+        p[4 + i] = fraction >> (24 - 8 * i);
+    }
+}
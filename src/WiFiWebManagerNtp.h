@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+// SNTP-Client (RFC 4330) mit Qualitätsmessung, der nicht auf Antworten wartet
+// (blockierend ist nur die DNS-Auflösung der Servernamen):
+// misst Offset und Laufzeit jeder Antwort, stellt große Abweichungen sofort (settimeofday)
+// und gleicht kleine sanft aus (adjtime), schätzt die Drift des Quarzes und passt das
+// Abfrageintervall an (64 s nach Neustart/Sprung, bis 4096 s bei stabiler Uhr).
+// Mehrere Server (durch Komma getrennt, optional "host:port") werden der Reihe nach
+// verwendet - fällt einer aus, übernimmt der nächste.
+class WiFiWebManagerNtp {
+public:
+    struct Status {
+        bool synced = false;
+        String server;                  // Server der letzten erfolgreichen Synchronisation
+        uint8_t stratum = 0;
+        int64_t offsetUs = 0;           // Letzter gemessener Offset (Server - lokal), beim Stellen auch Jahre
+        uint32_t delayUs = 0;           // Letzte Round-Trip-Zeit ohne Server-Bearbeitungszeit
+        float driftPpm = 0;             // Geschätzte Gangabweichung der lokalen Uhr (+ = geht vor)
+        uint32_t pollIntervalS = 0;     // Aktuelles Abfrageintervall
+        unsigned long lastSyncMillis = 0;
+        uint32_t syncCount = 0;
+        uint32_t stepCount = 0;         // Wie oft die Uhr gestellt (statt nachgeführt) wurde
+        uint32_t failCount = 0;         // Zeitüberschreitungen und ungültige Antworten
+        const char* lastError = "";
+    };
+
+    ~WiFiWebManagerNtp();
+
+    void setServers(const String& list);    // z.B. "ptbtime1.ptb.de, pool.ntp.org"
+    bool begin();
+    void stop();
+    void loop();                            // Regelmäßig aufrufen, blockiert nur beim Auflösen eines Namens
+    void syncNow();                         // Nächste Abfrage sofort (z.B. nach Reconnect)
+
+    bool isRunning() const { return sock >= 0; }
+    const Status& status() const { return state; }
+
+    static const uint32_t MIN_POLL_S = 64;
+    static const uint32_t MAX_POLL_S = 4096;
+    static const int32_t STEP_THRESHOLD_US = 128000;   // Darüber wird gestellt statt nachgeführt
+
+private:
+    struct Server {
+        String host;
+        uint16_t port;
+        uint32_t address;   // Aufgelöste IPv4-Adresse (Netzwerk-Byteorder), 0 = neu auflösen
+    };
+
+    static const uint16_t NTP_PORT = 123;
+    static const size_t PACKET_SIZE = 48;
+    static const unsigned long RESPONSE_TIMEOUT_MS = 2000;
+    static const int32_t STABLE_OFFSET_US = 32000;      // Ziel-Genauigkeit zwischen zwei Abfragen
+
+    std::vector<Server> servers;
+    size_t serverIndex = 0;
+    int sock = -1;
+    Status state;
+
+    uint8_t pollExp = 6;            // Intervall = 2^pollExp Sekunden
+    uint8_t stableCount = 0;
+    unsigned long scheduledAt = 0;
+    unsigned long pollDelayMs = 0;
+    size_t failuresInRow = 0;
+
+    // Laufende Anfrage
+    bool waiting = false;
+    unsigned long sentMillis = 0;
+    int64_t sentUs = 0;             // T1, lokale Zeit beim Senden
+    uint8_t sentStamp[8];           // Transmit-Timestamp der Anfrage, muss als Originate zurückkommen
+
+    // Für die Driftschätzung: Zeitpunkt der letzten Korrektur (0 = noch keine)
+    int64_t lastCorrectionUs = 0;
+    bool driftValid = false;
+
+    void sendRequest();
+    void receiveResponse();
+    void handleFailure(const char* reason);
+    void applySample(int64_t offsetUs, int64_t delayUs, uint8_t stratum);
+    uint32_t pollInterval() const;
+    void schedule(unsigned long delayMs);
+
+    static int64_t nowUs();
+    static int64_t fromNtp(const uint8_t* p);
+    static void toNtp(int64_t us, uint8_t* p);
+};
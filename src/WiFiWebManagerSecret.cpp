@@ -0,0 +1,104 @@
+#include "WiFiWebManagerSecret.h"
+
+#include <vector>
+#include <mbedtls/version.h>
+#include <mbedtls/md.h>
+#include <mbedtls/pkcs5.h>
+#include <mbedtls/gcm.h>
+
+namespace WiFiWebManagerSecret {
+
+void randomBytes(uint8_t* out, size_t len) {
+    // esp_random() nutzt den Hardware-RNG (bei aktivem WLAN echter Zufall)
+    while (len > 0) {
+        uint32_t r = esp_random();
+        size_t n = len < 4 ? len : 4;
+        memcpy(out, &r, n);
+        out += n;
+        len -= n;
+    }
+}
+
+bool deriveKey(const String& passphrase, const uint8_t* salt, size_t saltLen, uint8_t key[KEY_SIZE]) {
+#if MBEDTLS_VERSION_NUMBER >= 0x03030000
+    return mbedtls_pkcs5_pbkdf2_hmac_ext(MBEDTLS_MD_SHA256, (const unsigned char*)passphrase.c_str(), passphrase.length(),
+                                         salt, saltLen, KDF_ITERATIONS, KEY_SIZE, key) == 0;
+#else
+    mbedtls_md_context_t md;
+    mbedtls_md_init(&md);
+    bool ok = mbedtls_md_setup(&md, mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), 1) == 0 &&
+              mbedtls_pkcs5_pbkdf2_hmac(&md, (const unsigned char*)passphrase.c_str(), passphrase.length(),
+                                        salt, saltLen, KDF_ITERATIONS, KEY_SIZE, key) == 0;
+    mbedtls_md_free(&md);
+    return ok;
+#endif
+}
+
+String seal(const uint8_t key[KEY_SIZE], const String& name, const String& plaintext) {
+    size_t len = plaintext.length();
+    std::vector<uint8_t> buf(IV_SIZE + len + TAG_SIZE);
+    randomBytes(buf.data(), IV_SIZE);
+
+    mbedtls_gcm_context gcm;
+    mbedtls_gcm_init(&gcm);
+    bool ok = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, KEY_SIZE * 8) == 0 &&
+              mbedtls_gcm_crypt_and_tag(&gcm, MBEDTLS_GCM_ENCRYPT, len, buf.data(), IV_SIZE,
+                                        (const unsigned char*)name.c_str(), name.length(),
+                                        (const unsigned char*)plaintext.c_str(), buf.data() + IV_SIZE,
+                                        TAG_SIZE, buf.data() + IV_SIZE + len) == 0;
+    mbedtls_gcm_free(&gcm);
+    return ok ? toHex(buf.data(), buf.size()) : String();
+}
+
+bool open(const uint8_t key[KEY_SIZE], const String& name, const String& sealed, String& plaintext) {
+    if (sealed.length() % 2 != 0 || sealed.length() < 2 * (IV_SIZE + TAG_SIZE)) return false;
+    size_t total = sealed.length() / 2;
+    size_t len = total - IV_SIZE - TAG_SIZE;
+    std::vector<uint8_t> buf(total);
+    std::vector<uint8_t> out(len + 1);
+    if (!fromHex(sealed.c_str(), sealed.length(), buf.data())) return false;
+
+    mbedtls_gcm_context gcm;
+    mbedtls_gcm_init(&gcm);
+    bool ok = mbedtls_gcm_setkey(&gcm, MBEDTLS_CIPHER_ID_AES, key, KEY_SIZE * 8) == 0 &&
+              mbedtls_gcm_auth_decrypt(&gcm, len, buf.data(), IV_SIZE,
+                                       (const unsigned char*)name.c_str(), name.length(),
+                                       buf.data() + IV_SIZE + len, TAG_SIZE,
+                                       buf.data() + IV_SIZE, out.data()) == 0;
+    mbedtls_gcm_free(&gcm);
+    if (!ok) return false;
+    plaintext = "";
+    plaintext.concat((const char*)out.data(), len);
+    return true;
+}
+
+String toHex(const uint8_t* data, size_t len) {
+    static const char digits[] = "0123456789abcdef";
+    String hex;
+    hex.reserve(len * 2);
+    for (size_t i = 0; i < len; i++) {
+        hex += digits[data[i] >> 4];
+        hex += digits[data[i] & 0x0F];
+    }
+    return hex;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool fromHex(const char* hex, size_t hexLen, uint8_t* out) {
+    if (hexLen % 2 != 0) return false;
+    for (size_t i = 0; i < hexLen; i += 2) {
+        int hi = hexValue(hex[i]);
+        int lo = hexValue(hex[i + 1]);
+        if (hi < 0 || lo < 0) return false;
+        out[i / 2] = (uint8_t)(hi << 4 | lo);
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Verschlüsselung einzelner Konfigurationswerte (Export/Import):
+// Schlüssel per PBKDF2-HMAC-SHA256 aus einer Passphrase, Werte mit AES-256-GCM.
+// Der Name des Feldes geht als zusätzliche authentisierte Daten ein - ein Wert lässt sich
+// also nicht unbemerkt in ein anderes Feld kopieren, eine falsche Passphrase fällt sofort auf.
+namespace WiFiWebManagerSecret {
+    const size_t KEY_SIZE = 32;
+    const size_t SALT_SIZE = 16;
+    const size_t IV_SIZE = 12;
+    const size_t TAG_SIZE = 16;
+    const unsigned KDF_ITERATIONS = 2048;
+
+    void randomBytes(uint8_t* out, size_t len);
+    bool deriveKey(const String& passphrase, const uint8_t* salt, size_t saltLen, uint8_t key[KEY_SIZE]);
+
+    // Ergebnis als Hex: IV | Chiffretext | Tag; leerer String bei Fehler
+    String seal(const uint8_t key[KEY_SIZE], const String& name, const String& plaintext);
+    bool open(const uint8_t key[KEY_SIZE], const String& name, const String& sealed, String& plaintext);
+
+    String toHex(const uint8_t* data, size_t len);
+    bool fromHex(const char* hex, size_t hexLen, uint8_t* out);
+}